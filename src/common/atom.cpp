@@ -61,6 +61,30 @@ vector<string> Atom::tab_symbol={
       "Tl", "Pb", "Bi", "Po", "At", "Rn", "Fr", "Ra", "Ac", "Th",
       "Pa", "U",  "Np", "Pu", "Am", "Cm", "Bk", "Cf", "Es", "Fm",
       "Md", "No", "Lr", "Rf", "Db", "Sg", "Bh", "Hs", "Mt" };
+static const char* const tab_name[MAXATNUMDEF]={
+   "Hydrogen", "Helium", "Lithium", "Beryllium", "Boron",
+   "Carbon", "Nitrogen", "Oxygen", "Fluorine", "Neon",
+   "Sodium", "Magnesium", "Aluminum", "Silicon", "Phosphorus",
+   "Sulfur", "Chlorine", "Argon", "Potassium", "Calcium",
+   "Scandium", "Titanium", "Vanadium", "Chromium", "Manganese",
+   "Iron", "Cobalt", "Nickel", "Copper", "Zinc",
+   "Gallium", "Germanium", "Arsenic", "Selenium", "Bromine",
+   "Krypton", "Rubidium", "Strontium", "Yttrium", "Zirconium",
+   "Niobium", "Molybdenum", "Technetium", "Ruthenium", "Rhodium",
+   "Palladium", "Silver", "Cadmium", "Indium", "Tin",
+   "Antimony", "Tellurium", "Iodine", "Xenon", "Cesium",
+   "Barium", "Lanthanum", "Cerium", "Praseodymium", "Neodymium",
+   "Promethium", "Samarium", "Europium", "Gadolinium", "Terbium",
+   "Dysprosium", "Holmium", "Erbium", "Thulium", "Ytterbium",
+   "Lutetium", "Hafnium", "Tantalum", "Tungsten", "Rhenium",
+   "Osmium", "Iridium", "Platinum", "Gold", "Mercury",
+   "Thallium", "Lead", "Bismuth", "Polonium", "Astatine",
+   "Radon", "Francium", "Radium", "Actinium", "Thorium",
+   "Protactinium", "Uranium", "Neptunium", "Plutonium", "Americium",
+   "Curium", "Berkelium", "Californium", "Einsteinium", "Fermium",
+   "Mendelevium", "Nobelium", "Lawrencium", "Rutherfordium", "Dubnium",
+   "Seaborgium", "Bohrium", "Hassium", "Meitnerium"
+};
 /* Most of the hard-coded data was taken from:
  * https://www.science.co.il/elements/
  * Last access: 2018-Apr-18  */
@@ -142,35 +166,19 @@ double Atom::GetAtomicWeight(int n) {
    return tab_weight[n-1];
 }
 string Atom::GetName(int n) {
-   static string tab_name[MAXATNUMDEF]={
-      "Hydrogen", "Helium", "Lithium", "Beryllium", "Boron",
-      "Carbon", "Nitrogen", "Oxygen", "Fluorine", "Neon",
-      "Sodium", "Magnesium", "Aluminum", "Silicon", "Phosphorus",
-      "Sulfur", "Chlorine", "Argon", "Potassium", "Calcium",
-      "Scandium", "Titanium", "Vanadium", "Chromium", "Manganese",
-      "Iron", "Cobalt", "Nickel", "Copper", "Zinc",
-      "Gallium", "Germanium", "Arsenic", "Selenium", "Bromine",
-      "Krypton", "Rubidium", "Strontium", "Yttrium", "Zirconium",
-      "Niobium", "Molybdenum", "Technetium", "Ruthenium", "Rhodium",
-      "Palladium", "Silver", "Cadmium", "Indium", "Tin",
-      "Antimony", "Tellurium", "Iodine", "Xenon", "Cesium",
-      "Barium", "Lanthanum", "Cerium", "Praseodymium", "Neodymium",
-      "Promethium", "Samarium", "Europium", "Gadolinium", "Terbium",
-      "Dysprosium", "Holmium", "Erbium", "Thulium", "Ytterbium",
-      "Lutetium", "Hafnium", "Tantalum", "Tungsten", "Rhenium",
-      "Osmium", "Iridium", "Platinum", "Gold", "Mercury",
-      "Thallium", "Lead", "Bismuth", "Polonium", "Astatine",
-      "Radon", "Francium", "Radium", "Actinium", "Thorium",
-      "Protactinium", "Uranium", "Neptunium", "Plutonium", "Americium",
-      "Curium", "Berkelium", "Californium", "Einsteinium", "Fermium",
-      "Mendelevium", "Nobelium", "Lawrencium", "Rutherfordium", "Dubnium",
-      "Seaborgium", "Bohrium", "Hassium", "Meitnerium"
-   };
    if ( n<1 ) {
       ScreenUtils::DisplayErrorMessage("n<1!");
       cout << __FILE__ << ", line: " << __LINE__ << endl;
       return "Error";
    }
+   return string(tab_name[n-1]);
+}
+const char* Atom::GetAtomicSymbolPtr(const int n) {
+   if ( n<1 || n>MAXATNUMDEF ) { return ""; }
+   return tab_symbol[n-1].c_str();
+}
+const char* Atom::GetNamePtr(const int n) {
+   if ( n<1 || n>MAXATNUMDEF ) { return ""; }
    return tab_name[n-1];
 }
 string Atom::GetAtomicSymbol(int n) {
@@ -208,14 +216,31 @@ bool Atom::IsMyPosition(vector<double> &xp) {
    }
    return res;
 }
-int Atom::GetAtomicNumberFromSymbol(string smb) {
-   int k=0;
-   while(smb!=tab_symbol[k] && k<MAXATNUMDEF) { ++k; }
-   if ( k==MAXATNUMDEF ) {
-      ScreenUtils::DisplayErrorMessage(string("Unknown atom! ")+smb);
+int Atom::FindAtomicNumber(const char* smb,const size_t len) {
+   /* The table is built only once (thread-safe initialization of
+    * function-local statics); each entry holds the atomic number
+    * (or zero) of the symbol whose packed index is the entry's index.  */
+   struct PackedSymbolTable {
+      unsigned char z[PACKEDSYMBOLTABLESIZE];
+      PackedSymbolTable() {
+         for ( int i=0 ; i<PACKEDSYMBOLTABLESIZE ; ++i ) { z[i]=0; }
+         for ( int i=0 ; i<MAXATNUMDEF ; ++i ) {
+            z[PackSymbol(tab_symbol[i].c_str(),tab_symbol[i].length())]=(unsigned char)(i+1);
+         }
+      }
+   };
+   static const PackedSymbolTable table;
+   int idx=PackSymbol(smb,len);
+   if ( idx<0 ) { return 0; }
+   return int(table.z[idx]);
+}
+int Atom::GetAtomicNumberFromSymbol(const char* smb,const size_t len) {
+   int res=FindAtomicNumber(smb,len);
+   if ( res==0 ) {
+      ScreenUtils::DisplayErrorMessage(string("Unknown atom! ")+string(smb,len));
       return -1;
    }
-   return k+1;
+   return res;
 }
 void Atom::DisplayProperties() {
    cout << "Symbol: " << symbol << endl;
@@ -73,12 +73,30 @@ public:
    /** Returns the atomic symbol of the atom whose atomic number is n
     * Notice: it must be the atomic number, not the index!  */
    static string GetAtomicSymbol(int n);
-   static int GetAtomicNumberFromSymbol(string smb);
+   /** Same as GetAtomicSymbol and GetName, but these return a pointer to
+    * the static tables (no copies are made), and an empty string (without
+    * displaying any message) if n is out of range.  */
+   static const char* GetAtomicSymbolPtr(const int n);
+   static const char* GetNamePtr(const int n);
+   /** Returns the atomic number of the element whose symbol is smb (e.g. "C",
+    * "Cl"). The lookup is done in constant time, using a table indexed
+    * by the (packed) two characters of the symbol. Returns -1, and displays
+    * an error, if the symbol is unknown.  */
+   static int GetAtomicNumberFromSymbol(const string &smb) {
+      return GetAtomicNumberFromSymbol(smb.c_str(),smb.length());
+   }
+   static int GetAtomicNumberFromSymbol(const char* smb,const size_t len);
+   /** Same as GetAtomicNumberFromSymbol, but it does not display
+    * any message; it returns 0 if smb is not a valid symbol.  */
+   static int FindAtomicNumber(const char* smb,const size_t len);
+   static int FindAtomicNumber(const string &smb) {
+      return FindAtomicNumber(smb.c_str(),smb.length());
+   }
    /** Returns the valence electrons of the atom whose atomic
     * number is n. In the current version, only neutral atoms
     * are treated, i.e. ions are not considered.  */
    static int GetValenceElectrons(const int n);
-   static int GetValenceElectrons(string s) { return GetValenceElectrons(GetAtomicNumberFromSymbol(s));}
+   static int GetValenceElectrons(const string &s) { return GetValenceElectrons(GetAtomicNumberFromSymbol(s));}
    /** Return the Van der Waals radius of the atom whose atomic number is atn
     *  units: Angstroms*/
    static double GetVDWRadius(const int atn);
@@ -98,6 +116,20 @@ protected:
    Atom();
    void Init();
    static vector<string> tab_symbol;
+   /** Size of the packed symbol table: the first character is
+    * one of 'A'-'Z', the second is none or one of 'a'-'z'.  */
+   static const int PACKEDSYMBOLTABLESIZE=26*27;
+   /** Returns the index of a symbol in the packed table (or -1 if the
+    * symbol cannot be an element symbol).  */
+   static inline int PackSymbol(const char* smb,const size_t len) {
+      if ( len<1 || len>2 || smb[0]<'A' || smb[0]>'Z' ) { return -1; }
+      int res=27*int(smb[0]-'A');
+      if ( len==2 ) {
+         if ( smb[1]<'a' || smb[1]>'z' ) { return -1; }
+         res+=int(smb[1]-'a')+1;
+      }
+      return res;
+   }
 };
 /* ************************************************************************** */
 std::ostream &operator<<(std::ostream &out,const Atom (&atom));
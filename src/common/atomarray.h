@@ -0,0 +1,194 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _ATOMARRAY_H_
+#define _ATOMARRAY_H_
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+using std::vector;
+#include "atom.h"
+
+/* ************************************************************************** */
+/** Minimal allocator that returns ALIGN-byte aligned blocks (see
+ * AtomArray).  */
+template<typename T,size_t ALIGN> struct AlignedAllocator {
+   typedef T value_type;
+   template<typename U> struct rebind { typedef AlignedAllocator<U,ALIGN> other; };
+   AlignedAllocator() {}
+   template<typename U> AlignedAllocator(const AlignedAllocator<U,ALIGN> &) {}
+   T* allocate(const size_t n) {
+      void* p=nullptr;
+      if ( posix_memalign(&p,ALIGN,(n>0 ? n : 1)*sizeof(T))!=0 ) { throw std::bad_alloc(); }
+      return static_cast<T*>(p);
+   }
+   void deallocate(T* p,const size_t) { free(p); }
+};
+template<typename T,typename U,size_t ALIGN>
+bool operator==(const AlignedAllocator<T,ALIGN> &,const AlignedAllocator<U,ALIGN> &) { return true; }
+template<typename T,typename U,size_t ALIGN>
+bool operator!=(const AlignedAllocator<T,ALIGN> &,const AlignedAllocator<U,ALIGN> &) { return false; }
+/* ************************************************************************** */
+/** The three coordinates of an atom of an AtomArray. It behaves as the
+ * vector<double> x of the class Atom: x[j] is a reference to the j-th
+ * coordinate, and it can be converted to (or assigned from) a vector<double>.
+ * T is double, or const double for read-only views.  */
+template<typename T> class AtomCoordinates {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   AtomCoordinates(T* px,T* py,T* pz) { p[0]=px; p[1]=py; p[2]=pz; }
+   T &operator[](const size_t j) const { return *(p[j]); }
+   size_t size() const { return 3; }
+   operator vector<double>() const { return vector<double>{*(p[0]),*(p[1]),*(p[2])}; }
+   /** Both assignments copy the values, not the pointers.  */
+   const AtomCoordinates &operator=(const vector<double> &v) const {
+      *(p[0])=v[0]; *(p[1])=v[1]; *(p[2])=v[2];
+      return *this;
+   }
+   const AtomCoordinates &operator=(const AtomCoordinates &o) const {
+      *(p[0])=o[0]; *(p[1])=o[1]; *(p[2])=o[2];
+      return *this;
+   }
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   T* p[3];
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+/** View of the i-th atom of an AtomArray, with the same public members
+ * as the class Atom (so that atom[i].x[j], atom[i].num, atom[i].symbol,
+ * etc. keep working). The symbol, name, and weight are taken from the
+ * static tables of Atom, using the atomic number.  */
+template<typename T> struct AtomView {
+   AtomView(T* px,T* py,T* pz,const int an) : x(px,py,pz) {
+      num=an;
+      weight=((num>0) ? Atom::GetAtomicWeight(num) : 0.0e0);
+      symbol=Atom::GetAtomicSymbolPtr(num);
+      name=Atom::GetNamePtr(num);
+   }
+   AtomView &operator=(const AtomView &)=delete;
+   double GetVDWRadius() const { return Atom::GetVDWRadius(num); }
+   void DisplayProperties() const {
+      std::cout << "Symbol: " << symbol << std::endl;
+      std::cout << "Number: " << num << std::endl;
+      std::cout << "  Name: " << name << std::endl;
+      std::cout << "Weight: " << weight << std::endl;
+      std::cout << "     x: " << x[0] << " " << x[1] << " " << x[2] << std::endl;
+   }
+   AtomCoordinates<T> x;
+   int num;
+   double weight;
+   const char* symbol;
+   const char* name;
+};
+template<typename T> std::ostream &operator<<(std::ostream &out,const AtomView<T> &atm) {
+   return out << std::setw(2) << atm.symbol << " (" << atm.num
+              << ", '" << atm.name << "', " << atm.weight << "): "
+              << atm.x[0] << " " << atm.x[1] << " " << atm.x[2];
+}
+/* ************************************************************************** */
+/** Atoms of a Molecule, stored as a structure of arrays: the coordinates
+ * are kept in three contiguous (64-byte aligned) arrays, and the atomic
+ * numbers in an array of bytes; the remaining properties are looked up in
+ * the static tables of Atom. Loops over the atoms should use X(), Y(), Z(),
+ * and AtomicNumber(); operator[] returns an AtomView, which keeps the
+ * atom[i].x[j]-style access (and atom[i].symbol, etc.) of the old
+ * vector<Atom> working.  */
+class AtomArray {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   typedef vector<double,AlignedAllocator<double,64> > CoordinateVector;
+   size_t size() const { return atNum.size(); }
+   bool empty() const { return atNum.empty(); }
+   void clear() { xx.clear(); yy.clear(); zz.clear(); atNum.clear(); }
+   void reserve(const size_t n) { xx.reserve(n); yy.reserve(n); zz.reserve(n); atNum.reserve(n); }
+   /** Appends an atom. Atomic numbers out of range (e.g. the -1 returned
+    * for unknown symbols) are saved as 0.  */
+   void push_back(const double px,const double py,const double pz,const int an) {
+      xx.push_back(px);
+      yy.push_back(py);
+      zz.push_back(pz);
+      atNum.push_back(uint8_t((an>0 && an<=MAXATNUMDEF) ? an : 0));
+   }
+   AtomView<double> operator[](const size_t i) {
+      return AtomView<double>(&xx[i],&yy[i],&zz[i],int(atNum[i]));
+   }
+   AtomView<const double> operator[](const size_t i) const {
+      return AtomView<const double>(&xx[i],&yy[i],&zz[i],int(atNum[i]));
+   }
+   /** Swaps the atoms i and j (three doubles and one byte).  */
+   void Swap(const size_t i,const size_t j) {
+      std::swap(xx[i],xx[j]);
+      std::swap(yy[i],yy[j]);
+      std::swap(zz[i],zz[j]);
+      std::swap(atNum[i],atNum[j]);
+   }
+   double* X() { return xx.data(); }
+   double* Y() { return yy.data(); }
+   double* Z() { return zz.data(); }
+   const double* X() const { return xx.data(); }
+   const double* Y() const { return yy.data(); }
+   const double* Z() const { return zz.data(); }
+   /** Returns X(), Y(), or Z(), for j=0, 1, or 2.  */
+   double* Coordinate(const size_t j) { return (j==0 ? X() : (j==1 ? Y() : Z())); }
+   const double* Coordinate(const size_t j) const { return (j==0 ? X() : (j==1 ? Y() : Z())); }
+   int AtomicNumber(const size_t i) const { return int(atNum[i]); }
+   const uint8_t* AtomicNumbers() const { return atNum.data(); }
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   CoordinateVector xx,yy,zz;
+   vector<uint8_t> atNum;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _ATOMARRAY_H_ */
+
@@ -0,0 +1,124 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cmath>
+#include "atomspatialhash.h"
+
+AtomSpatialHash::AtomSpatialHash(const Molecule &mol,const double uEps) {
+   eps=uEps;
+   cellLen=eps*(1.0e0+1.0e-06);
+   if ( !(cellLen>0.0e0) ) { cellLen=1.0e0; }
+   const size_t nNuc=mol.Size();
+   const double* x=mol.atom.X();
+   const double* y=mol.atom.Y();
+   const double* z=mol.atom.Z();
+   /* Counting sort of the atoms into the buckets.  */
+   vector<int> atBucket(nNuc);
+   bucket.reserve(nNuc);
+   bucketStart.assign(1,0);
+   Key k;
+   for ( size_t i=0 ; i<nNuc ; ++i ) {
+      k.ix=CellCoordinate(x[i]);
+      k.iy=CellCoordinate(y[i]);
+      k.iz=CellCoordinate(z[i]);
+      k.an=mol.atom.AtomicNumber(i);
+      auto it=bucket.find(k);
+      if ( it==bucket.end() ) {
+         it=bucket.insert(std::make_pair(k,int(bucketStart.size()-1))).first;
+         bucketStart.push_back(0);
+      }
+      atBucket[i]=it->second;
+      ++bucketStart[it->second+1];
+   }
+   for ( size_t b=1 ; b<bucketStart.size() ; ++b ) { bucketStart[b]+=bucketStart[b-1]; }
+   vector<int> pos(bucketStart.begin(),bucketStart.end()-1);
+   idx.resize(nNuc);
+   xx.resize(nNuc);
+   yy.resize(nNuc);
+   zz.resize(nNuc);
+   int p;
+   for ( size_t i=0 ; i<nNuc ; ++i ) {
+      p=pos[atBucket[i]]++;
+      idx[p]=int(i);
+      xx[p]=x[i];
+      yy[p]=y[i];
+      zz[p]=z[i];
+   }
+}
+int AtomSpatialHash::CellCoordinate(const double xk) const {
+   double t=floor(xk/cellLen);
+   /* Far away atoms share the border cells; this is harmless, because the
+    * distances are always checked.  */
+   if ( !(t>-1.0e+09) ) { return -1000000000; }
+   if ( t>1.0e+09 ) { return 1000000000; }
+   return int(t);
+}
+size_t AtomSpatialHash::FindAtoms(const double x0[3],const int an,vector<int> &res) const {
+   size_t nFound=0;
+   Key k;
+   k.an=an;
+   const int cx=CellCoordinate(x0[0]);
+   const int cy=CellCoordinate(x0[1]);
+   const int cz=CellCoordinate(x0[2]);
+   double dx,dy,dz,sum;
+   for ( k.ix=cx-1 ; k.ix<=cx+1 ; ++k.ix ) {
+      for ( k.iy=cy-1 ; k.iy<=cy+1 ; ++k.iy ) {
+         for ( k.iz=cz-1 ; k.iz<=cz+1 ; ++k.iz ) {
+            auto it=bucket.find(k);
+            if ( it==bucket.end() ) { continue; }
+            for ( int p=bucketStart[it->second] ; p<bucketStart[it->second+1] ; ++p ) {
+               dx=x0[0]-xx[p];
+               dy=x0[1]-yy[p];
+               dz=x0[2]-zz[p];
+               sum=0.0e0;
+               sum+=(dx*dx);
+               sum+=(dy*dy);
+               sum+=(dz*dz);
+               if ( sqrt(sum)<eps ) {
+                  res.push_back(idx[p]);
+                  ++nFound;
+               }
+            }
+         }
+      }
+   }
+   return nFound;
+}
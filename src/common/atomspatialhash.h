@@ -0,0 +1,103 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _ATOMSPATIALHASH_H_
+#define _ATOMSPATIALHASH_H_
+#include <cstddef>
+#include <vector>
+using std::vector;
+#include <unordered_map>
+#include "molecule.h"
+
+/* ************************************************************************** */
+/** Spatial hash of the atoms of a molecule, used to find the atoms that
+ * match a given position (same atomic number, and distance smaller than
+ * eps). The atoms are binned into cubic cells of side eps (slightly
+ * enlarged, to absorb rounding errors); the key of a cell is made of its
+ * three integer coordinates and the atomic number, so only atoms of the
+ * right element are ever compared, and only the 27 cells around the query
+ * position need to be searched. The coordinates are copied (in the order of
+ * the cells), hence the hash does not change if the atoms of the molecule
+ * are later moved or reordered; the atoms are identified by their index at
+ * the moment the hash was built. Building the hash and every query take
+ * O(1) expected time per atom.  */
+class AtomSpatialHash {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   explicit AtomSpatialHash(const Molecule &mol,const double eps=COORDSEPSILON);
+   size_t Size() const { return idx.size(); }
+   /** Appends to res the indices of the atoms whose atomic number is an,
+    * and whose distance to x0 is smaller than eps. The distance is computed
+    * as in Molecule::AtomDistance, with x0 as the first atom. Returns the
+    * number of appended atoms.  */
+   size_t FindAtoms(const double x0[3],const int an,vector<int> &res) const;
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   struct Key {
+      int ix,iy,iz,an;
+      bool operator==(const Key &k) const { return ix==k.ix && iy==k.iy && iz==k.iz && an==k.an; }
+   };
+   struct KeyHash {
+      size_t operator()(const Key &k) const {
+         size_t h=size_t(k.ix)*size_t(73856093);
+         h^=size_t(k.iy)*size_t(19349663);
+         h^=size_t(k.iz)*size_t(83492791);
+         h^=size_t(k.an)*size_t(2654435761u);
+         return h;
+      }
+   };
+   int CellCoordinate(const double xk) const;
+   double eps;
+   double cellLen;
+   std::unordered_map<Key,int,KeyHash> bucket; /*!< Cell key -> position in bucketStart.  */
+   vector<int> bucketStart;
+   /* The atoms, sorted by bucket (the atoms of a bucket are in increasing
+    * order).  */
+   vector<int> idx;
+   vector<double> xx,yy,zz;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _ATOMSPATIALHASH_H_ */
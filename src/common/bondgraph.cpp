@@ -0,0 +1,368 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <iostream>
+using std::cout;
+#include <algorithm>
+#include <cstdint>
+#include "screenutils.h"
+#include "bondgraph.h"
+
+BondGraph::BondGraph() {
+   adjStart.assign(1,0);
+   fragStart.assign(1,0);
+   ringStart.assign(1,0);
+}
+bool BondGraph::Setup(const Molecule &mol) {
+   const size_t nNuc=mol.Size();
+   adj.clear();
+   adjBond.clear();
+   bndI.clear();
+   bndJ.clear();
+   bndLen.clear();
+   adjStart.assign(1,0);
+   fragment.clear();
+   fragStart.assign(1,0);
+   fragAtom.clear();
+   ringStart.assign(1,0);
+   ringAtom.clear();
+   if ( mol.bondStart.size()!=(nNuc+1) ) {
+      ScreenUtils::DisplayErrorMessage("The bonds of the molecule are not set up!");
+      cout << __FILE__ << ", fnc: " << __FUNCTION__ << ", line: " << __LINE__ << '\n';
+      return false;
+   }
+   const size_t nBnd=mol.bond.size();
+   bndI.resize(nBnd);
+   bndJ.resize(nBnd);
+   bndLen=mol.bndDist;
+   adjStart.assign(nNuc+1,0);
+   for ( size_t i=0 ; i<nNuc ; ++i ) {
+      for ( size_t k=mol.bondStart[i] ; k<mol.bondStart[i+1] ; ++k ) {
+         bndI[k]=int(i);
+         bndJ[k]=mol.bond[k];
+         ++adjStart[i+1];
+         ++adjStart[mol.bond[k]+1];
+      }
+   }
+   for ( size_t i=0 ; i<nNuc ; ++i ) { adjStart[i+1]+=adjStart[i]; }
+   /* Since the bonds are sorted by (i,j), filling both directions in this
+    * order leaves every row in increasing order.  */
+   vector<size_t> pos(adjStart.begin(),adjStart.end()-1);
+   adj.resize(2*nBnd);
+   adjBond.resize(2*nBnd);
+   for ( size_t e=0 ; e<nBnd ; ++e ) {
+      adj[pos[bndI[e]]]=bndJ[e];
+      adjBond[pos[bndI[e]]++]=int(e);
+      adj[pos[bndJ[e]]]=bndI[e];
+      adjBond[pos[bndJ[e]]++]=int(e);
+   }
+   return true;
+}
+int BondGraph::FindRoot(vector<int> &parent,int x) {
+   while ( parent[x]!=x ) {
+      parent[x]=parent[parent[x]];
+      x=parent[x];
+   }
+   return x;
+}
+void BondGraph::Unite(vector<int> &parent,vector<int> &rank,int x,int y) {
+   x=FindRoot(parent,x);
+   y=FindRoot(parent,y);
+   if ( x==y ) { return; }
+   if ( rank[x]<rank[y] ) { std::swap(x,y); }
+   parent[y]=x;
+   if ( rank[x]==rank[y] ) { ++rank[x]; }
+}
+size_t BondGraph::ComputeFragments() {
+   const size_t nNuc=NumberOfAtoms();
+   vector<int> parent(nNuc),rank(nNuc,0);
+   for ( size_t i=0 ; i<nNuc ; ++i ) { parent[i]=int(i); }
+   for ( size_t e=0 ; e<NumberOfBonds() ; ++e ) { Unite(parent,rank,bndI[e],bndJ[e]); }
+   /* Numbers the fragments in the order of their first atom (rank is
+    * reused as the fragment of every root).  */
+   fragment.assign(nNuc,-1);
+   fragStart.assign(1,0);
+   int nFrag=0,r;
+   for ( size_t i=0 ; i<nNuc ; ++i ) {
+      r=FindRoot(parent,int(i));
+      if ( fragment[r]<0 ) {
+         fragment[r]=nFrag++;
+         fragStart.push_back(0);
+      }
+      fragment[i]=fragment[r];
+      ++fragStart[fragment[i]+1];
+   }
+   for ( int f=0 ; f<nFrag ; ++f ) { fragStart[f+1]+=fragStart[f]; }
+   vector<size_t> pos(fragStart.begin(),fragStart.end()-1);
+   fragAtom.resize(nNuc);
+   for ( size_t i=0 ; i<nNuc ; ++i ) { fragAtom[pos[fragment[i]]++]=int(i); }
+   return size_t(nFrag);
+}
+vector<int> BondGraph::Distances(const size_t src) const {
+   vector<int> dist(NumberOfAtoms(),-1);
+   if ( src>=NumberOfAtoms() ) { return dist; }
+   vector<int> queue(1,int(src));
+   dist[src]=0;
+   int a,b;
+   for ( size_t q=0 ; q<queue.size() ; ++q ) {
+      a=queue[q];
+      for ( size_t k=adjStart[a] ; k<adjStart[a+1] ; ++k ) {
+         b=adj[k];
+         if ( dist[b]<0 ) {
+            dist[b]=dist[a]+1;
+            queue.push_back(b);
+         }
+      }
+   }
+   return dist;
+}
+vector<size_t> BondGraph::ShortestPath(const size_t src,const size_t dst) const {
+   vector<size_t> res(0);
+   const size_t nNuc=NumberOfAtoms();
+   if ( src>=nNuc || dst>=nNuc ) {
+      ScreenUtils::DisplayErrorMessage("Non existent atom!");
+      cout << __FILE__ << ", fnc: " << __FUNCTION__ << ", line: " << __LINE__ << '\n';
+      return res;
+   }
+   vector<int> prev(nNuc,-1);
+   vector<int> queue(1,int(src));
+   prev[src]=int(src);
+   int a,b;
+   for ( size_t q=0 ; q<queue.size() && prev[dst]<0 ; ++q ) {
+      a=queue[q];
+      for ( size_t k=adjStart[a] ; k<adjStart[a+1] ; ++k ) {
+         b=adj[k];
+         if ( prev[b]<0 ) {
+            prev[b]=a;
+            queue.push_back(b);
+         }
+      }
+   }
+   if ( prev[dst]<0 ) { return res; }
+   for ( int v=int(dst) ; v!=int(src) ; v=prev[v] ) { res.push_back(size_t(v)); }
+   res.push_back(src);
+   std::reverse(res.begin(),res.end());
+   return res;
+}
+size_t BondGraph::CycleRank() {
+   if ( fragment.size()!=NumberOfAtoms() ) { ComputeFragments(); }
+   return NumberOfBonds()+NumberOfFragments()-NumberOfAtoms();
+}
+void BondGraph::FindBridges(vector<bool> &isBridge) const {
+   const size_t nNuc=NumberOfAtoms();
+   isBridge.assign(NumberOfBonds(),false);
+   vector<int> disc(nNuc,-1),low(nNuc,0),parBond(nNuc,-1);
+   vector<size_t> next(nNuc);
+   vector<int> stack;
+   int time=0,a,b;
+   for ( size_t s=0 ; s<nNuc ; ++s ) {
+      if ( disc[s]>=0 ) { continue; }
+      disc[s]=low[s]=time++;
+      next[s]=adjStart[s];
+      stack.push_back(int(s));
+      while ( !stack.empty() ) {
+         a=stack.back();
+         if ( next[a]<adjStart[a+1] ) {
+            size_t k=next[a]++;
+            if ( adjBond[k]==parBond[a] ) { continue; }
+            b=adj[k];
+            if ( disc[b]<0 ) {
+               disc[b]=low[b]=time++;
+               parBond[b]=adjBond[k];
+               next[b]=adjStart[b];
+               stack.push_back(b);
+            } else if ( disc[b]<low[a] ) {
+               low[a]=disc[b];
+            }
+         } else {
+            stack.pop_back();
+            if ( parBond[a]>=0 ) {
+               b=stack.back();
+               if ( low[a]<low[b] ) { low[b]=low[a]; }
+               if ( low[a]>disc[b] ) { isBridge[parBond[a]]=true; }
+            }
+         }
+      }
+   }
+}
+void BondGraph::CycleBonds(const vector<int> &cycle,vector<int> &bnds) const {
+   int a,b;
+   for ( size_t l=0 ; l<cycle.size() ; ++l ) {
+      a=cycle[l];
+      b=cycle[(l+1)%cycle.size()];
+      for ( size_t k=adjStart[a] ; k<adjStart[a+1] ; ++k ) {
+         if ( adj[k]==b ) { bnds.push_back(adjBond[k]); break; }
+      }
+   }
+}
+void BondGraph::CanonicalRing(vector<int> &rg) {
+   std::rotate(rg.begin(),std::min_element(rg.begin(),rg.end()),rg.end());
+   if ( rg.size()>2 && rg.back()<rg[1] ) { std::reverse(rg.begin()+1,rg.end()); }
+}
+size_t BondGraph::ComputeSSSR(const size_t maxRingSize) {
+   ringStart.assign(1,0);
+   ringAtom.clear();
+   const size_t nNuc=NumberOfAtoms();
+   const size_t nBnd=NumberOfBonds();
+   /* Ring systems: components of the graph without its bridges.  */
+   vector<bool> isBridge;
+   FindBridges(isBridge);
+   vector<int> parent(nNuc),rank(nNuc,0);
+   for ( size_t i=0 ; i<nNuc ; ++i ) { parent[i]=int(i); }
+   for ( size_t e=0 ; e<nBnd ; ++e ) {
+      if ( !isBridge[e] ) { Unite(parent,rank,bndI[e],bndJ[e]); }
+   }
+   vector<int> sysOfRoot(nNuc,-1),inSys(nBnd,-1);
+   vector<vector<int> > sysBonds,sysAtoms;
+   int r;
+   for ( size_t e=0 ; e<nBnd ; ++e ) {
+      if ( isBridge[e] ) { continue; }
+      r=FindRoot(parent,bndI[e]);
+      if ( sysOfRoot[r]<0 ) {
+         sysOfRoot[r]=int(sysBonds.size());
+         sysBonds.push_back(vector<int>(0));
+         sysAtoms.push_back(vector<int>(0));
+      }
+      inSys[e]=sysOfRoot[r];
+      sysBonds[inSys[e]].push_back(int(e));
+   }
+   for ( size_t i=0 ; i<nNuc ; ++i ) {
+      r=FindRoot(parent,int(i));
+      if ( sysOfRoot[r]>=0 ) { sysAtoms[sysOfRoot[r]].push_back(int(i)); }
+   }
+   /* Breadth-first searches are limited to maxRingSize/2 bonds.  */
+   const int maxDepth=( maxRingSize>0 ) ? int(maxRingSize/2) : int(nNuc);
+   vector<int> dist(nNuc,-1),prev(nNuc,-1),local(nBnd,-1);
+   vector<vector<int> > cand,rings;
+   vector<int> queue,px,py,cycle,bnds;
+   for ( size_t s=0 ; s<sysBonds.size() ; ++s ) {
+      const vector<int> &sb=sysBonds[s];
+      const vector<int> &sa=sysAtoms[s];
+      const size_t rankS=sb.size()+1-sa.size();
+      for ( size_t l=0 ; l<sb.size() ; ++l ) { local[sb[l]]=int(l); }
+      /* Horton's candidates: for every atom a and bond (x,y), the cycle made
+       * of the shortest paths a-x and a-y (if they only share a) and the bond.
+       * This set contains a minimum cycle basis.  */
+      cand.clear();
+      for ( size_t l=0 ; l<sa.size() ; ++l ) {
+         const int a=sa[l];
+         queue.assign(1,a);
+         dist[a]=0;
+         prev[a]=a;
+         for ( size_t q=0 ; q<queue.size() ; ++q ) {
+            const int c=queue[q];
+            if ( dist[c]>=maxDepth ) { continue; }
+            for ( size_t k=adjStart[c] ; k<adjStart[c+1] ; ++k ) {
+               if ( inSys[adjBond[k]]!=int(s) || dist[adj[k]]>=0 ) { continue; }
+               dist[adj[k]]=dist[c]+1;
+               prev[adj[k]]=c;
+               queue.push_back(adj[k]);
+            }
+         }
+         for ( size_t q=0 ; q<queue.size() ; ++q ) {
+            const int x=queue[q];
+            for ( size_t k=adjStart[x] ; k<adjStart[x+1] ; ++k ) {
+               const int y=adj[k];
+               if ( inSys[adjBond[k]]!=int(s) || dist[y]<0 ) { continue; }
+               /* Every bond is taken once (from its atom with the largest
+                * distance to a, or from its smallest atom).  */
+               if ( dist[y]>dist[x] || (dist[y]==dist[x] && y<x) ) { continue; }
+               if ( prev[x]==y ) { continue; }
+               if ( maxRingSize>0 && size_t(dist[x]+dist[y]+1)>maxRingSize ) { continue; }
+               px.clear();
+               py.clear();
+               for ( int w=x ; w!=a ; w=prev[w] ) { px.push_back(w); }
+               for ( int w=y ; w!=a ; w=prev[w] ) { py.push_back(w); }
+               bool disjoint=true;
+               for ( size_t i=0 ; i<px.size() && disjoint ; ++i ) {
+                  if ( std::find(py.begin(),py.end(),px[i])!=py.end() ) { disjoint=false; }
+               }
+               if ( !disjoint ) { continue; }
+               cycle.assign(1,a);
+               cycle.insert(cycle.end(),px.rbegin(),px.rend());
+               cycle.insert(cycle.end(),py.begin(),py.end());
+               CanonicalRing(cycle);
+               cand.push_back(cycle);
+            }
+         }
+         for ( size_t q=0 ; q<queue.size() ; ++q ) { dist[queue[q]]=-1; }
+      }
+      std::sort(cand.begin(),cand.end(),[](const vector<int> &c1,const vector<int> &c2) {
+         return ( c1.size()!=c2.size() ) ? (c1.size()<c2.size()) : (c1<c2);
+      });
+      cand.erase(std::unique(cand.begin(),cand.end()),cand.end());
+      /* Selects the linearly independent candidates (Gaussian elimination
+       * over GF(2) of the bond incidence vectors), smallest first.  */
+      const size_t nw=(sb.size()+63)/64;
+      vector<vector<uint64_t> > basis;
+      vector<size_t> pivot;
+      vector<uint64_t> row(nw);
+      for ( size_t c=0 ; c<cand.size() && basis.size()<rankS ; ++c ) {
+         bnds.clear();
+         CycleBonds(cand[c],bnds);
+         std::fill(row.begin(),row.end(),0);
+         for ( size_t l=0 ; l<bnds.size() ; ++l ) {
+            row[local[bnds[l]]/64]^=(uint64_t(1)<<(local[bnds[l]]%64));
+         }
+         for ( size_t b=0 ; b<basis.size() ; ++b ) {
+            if ( (row[pivot[b]/64]>>(pivot[b]%64))&uint64_t(1) ) {
+               for ( size_t w=pivot[b]/64 ; w<nw ; ++w ) { row[w]^=basis[b][w]; }
+            }
+         }
+         size_t w=0;
+         while ( w<nw && row[w]==0 ) { ++w; }
+         if ( w==nw ) { continue; }
+         size_t p=64*w;
+         while ( !((row[w]>>(p%64))&uint64_t(1)) ) { ++p; }
+         basis.push_back(row);
+         pivot.push_back(p);
+         rings.push_back(cand[c]);
+      }
+      for ( size_t l=0 ; l<sb.size() ; ++l ) { local[sb[l]]=-1; }
+   }
+   std::stable_sort(rings.begin(),rings.end(),\
+         [](const vector<int> &c1,const vector<int> &c2) { return c1.size()<c2.size(); });
+   for ( size_t k=0 ; k<rings.size() ; ++k ) {
+      ringAtom.insert(ringAtom.end(),rings[k].begin(),rings[k].end());
+      ringStart.push_back(ringAtom.size());
+   }
+   return rings.size();
+}
@@ -0,0 +1,144 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _BONDGRAPH_H_
+#define _BONDGRAPH_H_
+#include <cstddef>
+#include <vector>
+using std::vector;
+#include "molecule.h"
+
+/* ************************************************************************** */
+/** Undirected graph of the bonds of a molecule (see Molecule::SetupBonds),
+ * stored in symmetric compressed sparse row form: the atoms bonded to the
+ * atom i are Neighbour(i,k), for k=0,...,(Degree(i)-1), in increasing order.
+ * Every bond has an index e (0,...,(NumberOfBonds()-1)), which is its
+ * position in Molecule::bond.
+ * Besides the adjacency, this class finds the fragments (connected
+ * components, with union-find), the smallest set of smallest rings (SSSR),
+ * and the shortest paths (breadth-first search) between atoms. The fragments
+ * and the paths are computed in (almost) linear time. The rings are searched
+ * only within the ring systems (the components left after removing the
+ * bridges, i.e., the bonds that do not belong to any cycle), hence their
+ * cost grows with the size of the largest ring system, not with the size
+ * of the molecule.  */
+class BondGraph {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   BondGraph();
+   /** Builds the graph from the bonds of mol (mol.SetupBonds() must have
+    * been called). Returns false if mol has no bonds set up.  */
+   bool Setup(const Molecule &mol);
+   size_t NumberOfAtoms() const { return adjStart.size()-1; }
+   size_t NumberOfBonds() const { return bndI.size(); }
+   size_t Degree(const size_t i) const { return adjStart[i+1]-adjStart[i]; }
+   int Neighbour(const size_t i,const size_t k) const { return adj[adjStart[i]+k]; }
+   /** Index of the bond between the atom i and Neighbour(i,k).  */
+   int BondIndex(const size_t i,const size_t k) const { return adjBond[adjStart[i]+k]; }
+   /** Length of the bond between the atom i and Neighbour(i,k).  */
+   double BondLength(const size_t i,const size_t k) const { return bndLen[adjBond[adjStart[i]+k]]; }
+   /** The atoms (i<j) of the bond e.  */
+   int BondAtomI(const size_t e) const { return bndI[e]; }
+   int BondAtomJ(const size_t e) const { return bndJ[e]; }
+/* ************************************************************************** */
+   /** Finds the fragments (sets of atoms connected by bonds). The fragments
+    * are numbered in the order of their first atom. Returns the number of
+    * fragments.  */
+   size_t ComputeFragments();
+   size_t NumberOfFragments() const { return fragStart.size()-1; }
+   /** Fragment of the atom i.  */
+   int Fragment(const size_t i) const { return fragment[i]; }
+   size_t FragmentSize(const size_t f) const { return fragStart[f+1]-fragStart[f]; }
+   /** The k-th atom of the fragment f (the atoms are in increasing order).  */
+   int FragmentAtom(const size_t f,const size_t k) const { return fragAtom[fragStart[f]+k]; }
+/* ************************************************************************** */
+   /** Number of bonds of the shortest path from src to every atom (-1 for
+    * the atoms that cannot be reached).  */
+   vector<int> Distances(const size_t src) const;
+   /** Returns the atoms of a shortest path from src to dst (both included),
+    * or an empty vector if there is no path. Ties are broken in favour of
+    * the atoms with the smallest indices.  */
+   vector<size_t> ShortestPath(const size_t src,const size_t dst) const;
+/* ************************************************************************** */
+   /** Finds the smallest set of smallest rings. If maxRingSize>0, only rings
+    * with at most maxRingSize atoms are searched (the set may then be
+    * incomplete, which is useful for three-dimensional networks). The rings
+    * are sorted by size. Returns the number of rings.  */
+   size_t ComputeSSSR(const size_t maxRingSize=0);
+   size_t NumberOfRings() const { return ringStart.size()-1; }
+   size_t RingSize(const size_t r) const { return ringStart[r+1]-ringStart[r]; }
+   /** The k-th atom of the ring r (consecutive atoms are bonded).  */
+   int RingAtom(const size_t r,const size_t k) const { return ringAtom[ringStart[r]+k]; }
+   /** Number of independent cycles (bonds-atoms+fragments). It equals the
+    * number of rings of the SSSR.  */
+   size_t CycleRank();
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   /** Union-find: returns the representative of the set of x.  */
+   static int FindRoot(vector<int> &parent,int x);
+   static void Unite(vector<int> &parent,vector<int> &rank,int x,int y);
+   /** Marks the bridges (isBridge[e]=true), using an iterative depth-first
+    * search.  */
+   void FindBridges(vector<bool> &isBridge) const;
+   /** Rotates (and reverses, if needed) the ring rg so that it starts at its
+    * smallest atom and continues towards the smallest of its two neighbours.  */
+   static void CanonicalRing(vector<int> &rg);
+   /** Appends the bonds of the cycle (a list of atoms) to bnds.  */
+   void CycleBonds(const vector<int> &cycle,vector<int> &bnds) const;
+   vector<size_t> adjStart;
+   vector<int> adj;
+   vector<int> adjBond;
+   vector<int> bndI;
+   vector<int> bndJ;
+   vector<double> bndLen;
+   vector<int> fragment;
+   vector<size_t> fragStart;
+   vector<int> fragAtom;
+   vector<size_t> ringStart;
+   vector<int> ringAtom;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _BONDGRAPH_H_ */
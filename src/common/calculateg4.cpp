@@ -45,14 +45,13 @@ using std::cout;
 using std::endl;
 using std::cerr;
 #include <cmath>
+#include <limits>
 #include "atom.h"
 #include "calculateg4.h"
+#include "g4batchkernel.h"
 #include "screenutils.h"
-#include "stringtools.h"
 #include "physicalconstants.h"
 
-#define NICOLAIDESLOWERBOUND 260.0e0
-
 CalculateG4::CalculateG4() {
    applySOCorr=false;
    useNicolaidesCorr=false;
@@ -66,22 +65,133 @@ CalculateG4::CalculateG4() {
    usrConstantM=false;
    useLHGap=false;
    usrConstantG=false;
+   dirty=DIRTYALL;
 }
 CalculateG4::CalculateG4(RawG4sData &data,int vlvl) : CalculateG4() {
    verboseLevel=vlvl;
    rd=&data;
    if ( verboseLevel>0 ) { PrintWarnings(); }
-   Compute();
 }
 void CalculateG4::Compute() {
+   if ( !(dirty&DIRTYRESULTS) ) { return; }
+   errorMessages.clear();
+   warningMessages.clear();
    SetupVars();
-   SafetyChecks();
+   if ( !SafetyChecks() ) {
+      SetResultsToNaN();
+      return;
+   }
    ComputeG4Energy();
    ComputeEnergiesFromStatTherm();
    ComputeG4Enthalpies0Kand298K();
    ComputeDeltaHf298KAtomization();
+   dirty&=(~DIRTYRESULTS);
 }
-void CalculateG4::ComputeG4Energy() {
+void CalculateG4::SetResultsToNaN() {
+   const double nan=std::numeric_limits<double>::quiet_NaN();
+   g4Energy=g4Enthalpy0K=g4Enthalpy298K=nan;
+   deltaHf0KAtomization=deltaHf298KAtomization=nan;
+   lclZPE=Evib=EvibJ=nan;
+   /* lclZPE was overwritten, and the cached energies may belong to another
+    * set of inputs.  */
+   dirty|=DIRTYEVIB;
+   dirty&=(~DIRTYRESULTS);
+}
+G4Variants CalculateG4::ComputeAllVariants() {
+   G4Variants res;
+   const double nan=std::numeric_limits<double>::quiet_NaN();
+   errorMessages.clear();
+   warningMessages.clear();
+   SetupVars();
+   res.method=rd->g4method;
+   res.scalingFreqFact=scalingFreqFact;
+   res.A=A;
+   res.alpha=alpha;
+   bool atctok;
+   res.scaledZPE=(rd->zpe)*scalingFreqFact;
+   if ( !CheckAtomicData(atctok) ) {
+      res.g4Energy=res.lclZPE=nan;
+      for ( int iv=0 ; iv<G4Variants::NEVIB ; ++iv ) {
+         res.evib[iv]=res.g4Enthalpy0K[iv]=nan;
+         for ( int ir=0 ; ir<G4Variants::NREF ; ++ir ) { res.deltaHf298K[iv][ir]=nan; }
+      }
+      SetResultsToNaN();
+      return res;
+   }
+   if ( !atctok ) {
+      AddWarningMessage("ATcT data is not available for all the atoms; ATcT variants set to nan.");
+   }
+   ComputeG4Energy();
+   double RT=PhysicalConstants::R*2.9815e+02*(G4AtomicProperties::JPMole2Hartree); // In hartrees
+   PV=RT; // in hartrees
+   Erot=((rd->islinear) ? 1.0e0 : 1.5e0)*RT; // in hartrees
+   Etrans=1.5e0*RT; //in hartrees
+   UpdateEvibCache();
+   double evibj[G4Variants::NEVIB];
+   evibj[G4Variants::HORR]=evibJHORR;
+   evibj[G4Variants::NICOLAIDES]=evibJNicolaides;
+   res.g4Energy=g4Energy;
+   res.lclZPE=lclZPE;
+   /* The atomic terms are accumulated in the same order as in
+    * ComputeDeltaHf298KAtomization, so that the results are identical.  */
+   double dhf0[G4Variants::NREF],dhf298Atoms[G4Variants::NREF];
+   for ( int ir=0 ; ir<G4Variants::NREF ; ++ir ) { dhf0[ir]=dhf298Atoms[ir]=g4Energy; }
+   int nAt;
+   double cnt;
+   G4AtomicProperties::DeltaHfSource src;
+   for ( size_t i=0 ; i<rd->compZ.size() ; ++i ) {
+      nAt=rd->compZ[i];
+      cnt=double(rd->compCount[i]);
+      for ( int ir=0 ; ir<G4Variants::NREF ; ++ir ) {
+         src=static_cast<G4AtomicProperties::DeltaHfSource>(ir);
+         dhf0[ir]+=cnt*(G4AtomicProperties::GetAtomizationOffset0K(src,nAt));
+         dhf298Atoms[ir]+=cnt*(G4AtomicProperties::GetAtomizationOffset298K(src,nAt));
+      }
+   }
+   if ( !atctok ) { dhf0[G4Variants::ATCT]=dhf298Atoms[G4Variants::ATCT]=nan; }
+   double dhf298[G4Variants::NEVIB][G4Variants::NREF]; // in hartrees
+   for ( int iv=0 ; iv<G4Variants::NEVIB ; ++iv ) {
+      res.evib[iv]=evibj[iv]*(G4AtomicProperties::JPMole2Hartree);
+      res.g4Enthalpy0K[iv]=g4Energy+res.evib[iv]+Erot+Etrans+PV;
+      for ( int ir=0 ; ir<G4Variants::NREF ; ++ir ) {
+         dhf298[iv][ir]=dhf298Atoms[ir];
+         dhf298[iv][ir]+=(res.evib[iv]+Erot+Etrans+PV);
+         res.deltaHf298K[iv][ir]=dhf298[iv][ir]*G4AtomicProperties::hartree2kJPerMole;
+      }
+   }
+   /* Members of the currently selected variant.  */
+   int iv=(useNicolaidesCorr ? G4Variants::NICOLAIDES : G4Variants::HORR);
+   int ir=(useTajtiCorr ? G4Variants::TAJTI : (useArgonneData ? G4Variants::ATCT : G4Variants::JANAF));
+   EvibJ=evibj[iv];
+   Evib=res.evib[iv];
+   g4Enthalpy0K=res.g4Enthalpy0K[iv];
+   deltaHf0KAtomization=dhf0[ir];
+   deltaHf298KAtomization=dhf298[iv][ir];
+   dirty&=(~DIRTYRESULTS);
+   return res;
+}
+static_assert(int(G4Variants::JANAF)==int(G4AtomicProperties::JANAF)\
+      && int(G4Variants::TAJTI)==int(G4AtomicProperties::TAJTI)\
+      && int(G4Variants::ATCT)==int(G4AtomicProperties::ATCT)\
+      && int(G4Variants::NREF)==int(G4AtomicProperties::NSOURCES),\
+      "G4Variants::AtomicReference and G4AtomicProperties::DeltaHfSource must match.");
+bool CalculateG4::ComputeAtomizationOffset(const RawG4sData &rd,\
+      const G4Variants::AtomicReference ref,double &off) {
+   const double RT=PhysicalConstants::R*2.9815e+02*(G4AtomicProperties::JPMole2Hartree); // In hartrees
+   const G4AtomicProperties::DeltaHfSource src=static_cast<G4AtomicProperties::DeltaHfSource>(ref);
+   const unsigned int need=G4AtomicProperties::ATOMIZATIONDATA\
+                           |((ref==G4Variants::ATCT) ? G4AtomicProperties::ATCTDATA : 0);
+   unsigned int mask=need;
+   off=0.0e0;
+   for ( size_t i=0 ; i<rd.compZ.size() ; ++i ) {
+      mask&=G4AtomicProperties::DataMask(rd.compZ[i]);
+      off+=double(rd.compCount[i])*(G4AtomicProperties::GetAtomizationOffset298K(src,rd.compZ[i]));
+   }
+   if ( mask!=need ) { return false; }
+   off+=(((rd.islinear) ? 1.0e0 : 1.5e0)*RT+1.5e0*RT+RT);
+   return true;
+}
+void CalculateG4::ComputeCombinedEnergy() {
    double B1=rd->mp2gtbas1;
    double B2=rd->mp4gtbas1;
    double B3=rd->ccsdtg3bas1;
@@ -93,17 +203,16 @@ void CalculateG4::ComputeG4Energy() {
    double B9=rd->mp2gtlargexp;
    double B10=rd->hfgfhfb1;
    double B11=rd->hfgfhfb2;
-   double B13=(rd->zpe)*scalingFreqFact;
-   double E_HFLim=(B11-B10*exp(-alpha))/(1.0e0-exp(-alpha));
-   double dEplus=B5-B2;
-   double dE2dfp=B7-B2;
-   double dECC=B3-B2;
-   double dEG3LargeXP=B9-B6-B4+B1;
-   double dEHF=E_HFLim-B8;
    double dESO=GetSpinOrbitCorr(); //Here would go the spin-orbit corrections (not needed for CHON).
-   double EComb=B2+dEplus+dE2dfp+dECC+dEG3LargeXP+dEHF+dESO;
+   /* Shared with G4BatchKernel, so that both paths give identical results.  */
+   eComb=G4BatchKernel::CombineEnergies(B1,B2,B3,B4,B5,B6,B7,B8,B9,B10,B11,exp(-alpha),dESO);
+   dirty&=(~DIRTYECOMB);
+}
+void CalculateG4::ComputeG4Energy() {
+   if ( dirty&DIRTYECOMB ) { ComputeCombinedEnergy(); }
+   double B13=(rd->zpe)*scalingFreqFact;
    double EHLC=GetHLCTerm();
-   double EeG4=EComb+EHLC;
+   double EeG4=eComb+EHLC;
    if ( useT1Diag ) {
       EeG4+=GetT1DiagTerm();
    }
@@ -116,32 +225,24 @@ double CalculateG4::GetSpinOrbitCorr() {
    return 0.0e0;
 }
 int CalculateG4::GetValenceElectrons() {
-   string s=rd->atomsInMolecule;
-   string symb;
    int res=0;
-   while ( s.size()>0 ) {
-      symb=StringTools::GetFirstChunkAndDeleteFromLine(s);
-      if ( symb==string("X") ) { continue; }
-      res+=(Atom::GetValenceElectrons(symb));
+   for ( size_t i=0 ; i<rd->compZ.size() ; ++i ) {
+      res+=(rd->compCount[i])*(Atom::GetValenceElectrons(rd->compZ[i]));
    }
    res/=2;
    return res;
 }
 int CalculateG4::GetTotalNumberOfElectrons() {
-   string s=rd->atomsInMolecule;
-   string symb;
    int res=0;
-   while ( s.size()>0 ) {
-      symb=StringTools::GetFirstChunkAndDeleteFromLine(s);
-      if ( symb==string("X") ) { continue; }
-      res+=(Atom::GetAtomicNumberFromSymbol(symb));
+   for ( size_t i=0 ; i<rd->compZ.size() ; ++i ) {
+      res+=(rd->compCount[i])*(rd->compZ[i]);
    }
    return res;
 }
 double CalculateG4::GetHLCTerm() {
    if ( (rd->nElAlpha) != (rd->nElBeta) ) {
-      ScreenUtils::DisplayErrorMessage("Only closed shell molecules are accepted!");
-      ScreenUtils::DisplayErrorMessage("No HLCTerm computed.");
+      AddErrorMessage("Only closed shell molecules are accepted!");
+      AddErrorMessage("No HLCTerm computed.");
       return 0.0e0;
    }
    int nValEl=GetValenceElectrons();
@@ -159,171 +260,101 @@ double CalculateG4::GetLHGapTerm() {
    return G/(LHGap);//*sqrt(nTotEl);
 }
 void CalculateG4::ComputeG4Enthalpies0Kand298K() {
-   string s=rd->atomsInMolecule;
-   string symb;
-   double sumHatom0=0.0e0;
-   double sumH298mH0=0.0e0;
-   int nAt=0;
-   while ( s.size()>0 ) {
-      symb=StringTools::GetFirstChunkAndDeleteFromLine(s);
-      if ( symb==string("X") ) { continue; }
-      nAt=Atom::GetAtomicNumberFromSymbol(symb);
-      //cout << nAt << ' ';
-      sumHatom0+=(G4AtomicProperties::GetG4StdEnthalpy0K(nAt));
-      sumH298mH0+=(G4AtomicProperties::GetG4StdH298mH0(nAt));
-   }
    g4Enthalpy0K=g4Energy+Evib+Erot+Etrans+PV;
 }
 void CalculateG4::ComputeDeltaHf298KAtomization() {
-   string s=rd->atomsInMolecule;
-   string symb;
-   deltaHf0KAtomization=g4Energy;
-   double sumDeltaHfAtom298Exp=0.0e0;
-   int nAt=0;
-   while ( s.size()>0 ) {
-      symb=StringTools::GetFirstChunkAndDeleteFromLine(s);
-      if ( symb==string("X") ) { continue; }
-      nAt=Atom::GetAtomicNumberFromSymbol(symb);
-      deltaHf0KAtomization-=(G4AtomicProperties::GetG4StdEnergy0K(nAt));
-      deltaHf0KAtomization+=(GetDeltaHfAtom0KExp(nAt));
-      sumDeltaHfAtom298Exp+=(GetDeltaHf298KmDeltaHf0KExp(nAt));
+   const G4AtomicProperties::DeltaHfSource src=GetDeltaHfSource();
+   deltaHf0KAtomization=deltaHf298KAtomization=g4Energy;
+   int nAt;
+   double cnt;
+   for ( size_t i=0 ; i<rd->compZ.size() ; ++i ) {
+      nAt=rd->compZ[i];
+      cnt=double(rd->compCount[i]);
+      deltaHf0KAtomization+=cnt*(G4AtomicProperties::GetAtomizationOffset0K(src,nAt));
+      deltaHf298KAtomization+=cnt*(G4AtomicProperties::GetAtomizationOffset298K(src,nAt));
    }
-   deltaHf298KAtomization=deltaHf0KAtomization;
    deltaHf298KAtomization+=(Evib+Erot+Etrans+PV);
-   deltaHf298KAtomization-=sumDeltaHfAtom298Exp;
-}
-void CalculateG4::ChooseFrequencyFactor() {
-   string method=rd->method;
-   if ( method==string("g4-std") ) {
-      scalingFreqFact=0.9854e0; // g09/G4 uses this factor 
-      //scalingFreqFact=0.9650e0; // As it appears in https://cccbdb.nist.gov/vibscalejust.asp
-   } else if ( method==string("g4-b3lyp") ) {
-      scalingFreqFact=0.95932e0;
-   } else if ( method==string("g4-m062x") ) {
-      scalingFreqFact=0.96196e0;
-   } else if ( method==string("g4-mp2") ) {
-      scalingFreqFact=0.93312e0;
-   } else if ( method==string("g4-wb97xd") ) {
-      scalingFreqFact=0.95606e0;
-   //} else if ( method==string("g4-pbe1pbe") ) {
-   //   scalingFreqFact=0.957e0;
-   //} else if ( method==string("g4-pbepbe" ) ) {
-   //   scalingFreqFact=0.990e0;
-   } else {
-      string msg="Scaling factor for the method '";
-      msg+=method;
+}
+void CalculateG4::ReportUnknownMethod() {
+   string msg;
+   if ( !usrScaleFact ) {
+      msg="Scaling factor for the method '";
+      msg+=rd->method;
       msg+="' is not implemented in this version. Setting scalingFreqFact=0.";
-      ScreenUtils::DisplayErrorMessage(msg);
-      cout << __FILE__ << ", line: " << __LINE__ << endl;
-      scalingFreqFact=0.0e0;
+      AddErrorMessage(msg);
    }
-}
-void CalculateG4::ChooseParameterA() {
-   string method=rd->method;
-   if ( method==string("g4-std") ) {
-      A=6.947e-3; // g09/G4 uses this factor 
-   } else if ( method==string("g4-b3lyp") ) {
-      A=6.7354e-3;
-   } else if ( method==string("g4-m062x") ) {
-      A=6.8188e-3;
-   } else if ( method==string("g4-mp2") ) {
-      A=6.7168e-3;
-   } else if ( method==string("g4-wb97xd") ) {
-      A=6.7867e-3;
-   //} else if ( method==string("g4-pbe1pbe") ) {
-   //   A=6.947e-3;
-   //} else if ( method==string("g4-pbepbe" ) ) {
-   //   A=6.947e-3;
-   } else {
-      string msg="Constant A for the method '";
-      msg+=method;
+   if ( !usrConstantA ) {
+      msg="Constant A for the method '";
+      msg+=rd->method;
       msg+="' is not implemented in this version. Setting A=0.";
-      ScreenUtils::DisplayErrorMessage(msg);
-      cout << __FILE__ << ", line: " << __LINE__ << endl;
-      A=0.0e0;
+      AddErrorMessage(msg);
    }
 }
 void CalculateG4::SetScalingFreqencyFactor(const double ff) {
    usrScaleFact=true;
    scalingFreqFact=ff;
+   dirty|=(DIRTYRESULTS|DIRTYEVIB);
 }
 void CalculateG4::SetConstantA(const double aa) {
    usrConstantA=true;
    A=aa;
+   dirty|=DIRTYRESULTS;
 }
 void CalculateG4::SetAlpha(const double aa) {
    usrAlpha=true;
    alpha=aa;
+   dirty|=(DIRTYRESULTS|DIRTYECOMB);
 }
 void CalculateG4::SetT1Diag(const double t1) {
    useT1Diag=true;
    T1d=t1;
+   dirty|=DIRTYRESULTS;
 }
 void CalculateG4::SetConstantM(const double mm) {
    usrConstantM=true;
    M=mm;
+   dirty|=DIRTYRESULTS;
 }
 void CalculateG4::SetLHGap(const double gap) {
    useLHGap=true;
    LHGap=gap;
+   dirty|=DIRTYRESULTS;
 }
 void CalculateG4::SetConstantG(const double gg) {
    usrConstantG=true;
    G=gg;
+   dirty|=DIRTYRESULTS;
 }
 void CalculateG4::SetupVars() {
-   if ( !usrScaleFact ) {
-      ChooseFrequencyFactor();
-   } else {
-      if ( verboseLevel>0 ) {
-         cout << "Using frequency factor: " << scalingFreqFact << '\n';
-      }
-   }
-   if ( !usrAlpha ) {
-      alpha=1.63e0;
-   } else {
-      if ( verboseLevel>0 ) {
-         cout << "Using alpha: " << alpha << '\n';
-      }
-   }
-   if ( !usrConstantA ) {
-      //A=0.006947e0;
-      ChooseParameterA();
-   } else {
-      if ( verboseLevel > 0 ) {
-         cout << "Using constant A: " << A << '\n';
-      }
-   }
-   B=0.002441e0;
-   C=0.007116e0;
-   D=0.001414e0;
-   if ( !usrConstantM ) {
-      M=0.0e0;
-   } else {
-      if ( verboseLevel>0 ) {
-         cout << "Using M: " << M << '\n';
-      }
-   }
-   if ( !useT1Diag ) {
-      T1d=0.0e0;
-   } else {
-      if ( verboseLevel>0 ) {
-         cout << "Using T1Diag: " << T1d << '\n';
-      }
-   }
-   if ( !usrConstantG ) {
-      G=0.0e0;
-   } else {
-      if ( verboseLevel>0 ) {
-         cout << "Using G: " << M << '\n';
-      }
+   /* The method was resolved when the report was read; see RawG4sData::SetupMethod. */
+   const G4MethodParameters &prm=G4Methods::GetParameters(rd->g4method);
+   if ( !usrScaleFact ) { scalingFreqFact=prm.scalingFreqFact; }
+   if ( !usrAlpha ) { alpha=prm.alpha; }
+   if ( !usrConstantA ) { A=prm.A; }
+   B=prm.B;
+   C=prm.C;
+   D=prm.D;
+   if ( rd->g4method==G4Method::UNKNOWN ) { ReportUnknownMethod(); }
+   if ( !usrConstantM ) { M=0.0e0; }
+   if ( !useT1Diag ) { T1d=0.0e0; }
+   if ( !usrConstantG ) { G=0.0e0; }
+   if ( !useLHGap ) { LHGap=0.0e0; }
+}
+void CalculateG4::DisplayParameters() const {
+   if ( usrScaleFact ) { cout << "Using frequency factor: " << scalingFreqFact << '\n'; }
+   if ( usrAlpha ) { cout << "Using alpha: " << alpha << '\n'; }
+   if ( usrConstantA ) { cout << "Using constant A: " << A << '\n'; }
+   if ( usrConstantM ) { cout << "Using M: " << M << '\n'; }
+   if ( useT1Diag ) { cout << "Using T1Diag: " << T1d << '\n'; }
+   if ( usrConstantG ) { cout << "Using G: " << G << '\n'; }
+   if ( useLHGap ) { cout << "Using LumoHomoGap: " << LHGap << '\n'; }
+}
+void CalculateG4::DisplayMessages() const {
+   for ( size_t i=0 ; i<warningMessages.size() ; ++i ) {
+      ScreenUtils::DisplayWarningMessage(warningMessages[i]);
    }
-   if ( !useLHGap ) {
-      LHGap=0.0e0;
-   } else {
-      if ( verboseLevel>0 ) {
-         cout << "Using LumoHomoGap: " << LHGap << '\n';
-      }
+   for ( size_t i=0 ; i<errorMessages.size() ; ++i ) {
+      ScreenUtils::DisplayErrorMessage(errorMessages[i]);
    }
 }
 void CalculateG4::PrintWarnings() {
@@ -331,40 +362,25 @@ void CalculateG4::PrintWarnings() {
    msg+="\n   a) The G4 can be obtained ONLY for closed shell molecules.";
    ScreenUtils::DisplayWarningMessage(msg);
 }
-double CalculateG4::GetDeltaHfAtom0KExp(int nAt) {
-   if ( useTajtiCorr ) {
-      return G4AtomicProperties::GetDeltaHf0KTajti(nAt);
-   }
-   if ( useArgonneData ) {
-      return G4AtomicProperties::GetDeltaHf0KATcT(nAt);
-   }
-   return G4AtomicProperties::GetDeltaHf0KJANAF(nAt);
+G4AtomicProperties::DeltaHfSource CalculateG4::GetDeltaHfSource() const {
+   if ( useTajtiCorr ) { return G4AtomicProperties::TAJTI; }
+   if ( useArgonneData ) { return G4AtomicProperties::ATCT; }
+   return G4AtomicProperties::JANAF;
+}
+void CalculateG4::ComputeEvibHORRAndNicolaides(double &evibho,double &evibnic) {
+   vibk.Setup(rd->frequencies,scalingFreqFact);
+   vibk.ComputeEvib(2.9815e+02,evibho,evibnic);
+   lclZPE=vibk.ZPE(); // in hartrees; scaled
 }
-double CalculateG4::GetDeltaHf298KmDeltaHf0KExp(int nAt) {
-   return G4AtomicProperties::GetDeltaHf298KNISTJANAF(nAt);
+void CalculateG4::UpdateEvibCache() {
+   if ( !(dirty&DIRTYEVIB) ) { return; }
+   ComputeEvibHORRAndNicolaides(evibJHORR,evibJNicolaides);
+   dirty&=(~DIRTYEVIB);
 }
 void CalculateG4::ComputeEvib() {
-   double fc100=100.0e0*scalingFreqFact*PhysicalConstants::c;
-   double ookT=1.0e0/(2.9815e+02*PhysicalConstants::kB);
-   double NA=PhysicalConstants::NA;
-   double h=PhysicalConstants::h;
-   double hnui,hnuiokT;
-   double sum=0.0e0;
-   lclZPE=0.0e0;
-   double RT=PhysicalConstants::R*2.9815e+02; // In Joules/mol
-   for ( size_t i=0 ; i<(rd->frequencies.size()) ; ++i ) {
-      hnui=fc100*(rd->frequencies[i])*h;
-      hnuiokT=hnui*ookT;
-      if ( useNicolaidesCorr && (scalingFreqFact*(rd->frequencies[i])) < NICOLAIDESLOWERBOUND ) {
-         sum+=(0.5e0*RT);
-      } else {
-         sum+=(NA*hnui/(exp(hnuiokT)-1.0e0));
-      }
-      lclZPE+=0.5e0*hnui;
-   }
-   EvibJ=sum; // in Joules/mol
+   UpdateEvibCache();
+   EvibJ=(useNicolaidesCorr ? evibJNicolaides : evibJHORR); // in Joules/mol
    Evib=EvibJ*(G4AtomicProperties::JPMole2Hartree); //in hartrees
-   lclZPE*=NA*G4AtomicProperties::JPMole2Hartree; // in hartrees; scaled
 }
 void CalculateG4::ComputeEnergiesFromStatTherm() {
    double RT=PhysicalConstants::R*2.9815e+02*(G4AtomicProperties::JPMole2Hartree); // In hartrees
@@ -373,9 +389,55 @@ void CalculateG4::ComputeEnergiesFromStatTherm() {
    Etrans=1.5e0*RT; //in hartrees
    ComputeEvib();
 }
-void CalculateG4::SafetyChecks() {
+bool CalculateG4::SafetyChecks() {
    if ( useTajtiCorr&&useArgonneData ) {
-      ScreenUtils::DisplayErrorMessage("Tajti and Agonne is not recommended!");
+      AddWarningMessage("Tajti and Agonne is not recommended!");
+   }
+   return CheckAtomicData();
+}
+bool CalculateG4::CheckAtomicData() {
+   bool atctok;
+   bool res=CheckAtomicData(atctok);
+   if ( useArgonneData && (!useTajtiCorr) && (!atctok) ) { res=false; }
+   return res;
+}
+bool CalculateG4::CheckAtomicData(bool &atctok) {
+   if ( rd->compZ.size()==0 ) {
+      AddErrorMessage("The composition of the molecule is empty!");
+      atctok=false;
+      return false;
+   }
+   unsigned int mask=G4AtomicProperties::ATOMIZATIONDATA|G4AtomicProperties::ATCTDATA;
+   for ( size_t i=0 ; i<rd->compZ.size() ; ++i ) {
+      mask&=G4AtomicProperties::DataMask(rd->compZ[i]);
+   }
+   atctok=((mask&G4AtomicProperties::ATCTDATA)!=0);
+   /* The loop below only collects the messages of the missing atoms.  */
+   if ( atctok ) { return true; }
+   if ( (mask&G4AtomicProperties::ATOMIZATIONDATA) && !(useArgonneData && (!useTajtiCorr)) ) {
+      return true;
    }
+   atctok=true;
+   bool res=true;
+   int nAt;
+   string symb;
+   for ( size_t i=0 ; i<rd->compZ.size() ; ++i ) {
+      nAt=rd->compZ[i];
+      symb=Atom::GetAtomicSymbol(nAt);
+      if ( nAt>18 ) {
+         AddErrorMessage(string("Only atoms of the first three rows of "
+                  "the periodic table are implemented (")+symb+string(")."));
+         res=false;
+      } else if ( !G4AtomicProperties::HasAtomizationData(nAt) ) {
+         AddErrorMessage(string("No atomic data available for ")+symb+string("."));
+         res=false;
+      } else if ( !G4AtomicProperties::HasATcTData(nAt) ) {
+         atctok=false;
+         if ( useArgonneData && (!useTajtiCorr) ) {
+            AddErrorMessage(string("The data is not available for this atom (dHf0KexpATcT!): ")+symb);
+         }
+      }
+   }
+   return res;
 }
 
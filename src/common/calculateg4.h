@@ -44,45 +44,112 @@
 #include "rawg4sdata.h"
 #include <memory>
 using std::shared_ptr;
+#include <vector>
+using std::vector;
+#include <string>
+using std::string;
+#include <algorithm>
 #include "g4atomicproperties.h"
+#include "g4methods.h"
+#include "g4vibkernel.h"
 
+/* ************************************************************************** */
+/** Results of CalculateG4::ComputeAllVariants(). The vibrational energy is
+ * computed within the harmonic oscillator/rigid rotor approximation (HO-RR),
+ * or applying the Nicolaides correction (first index). The experimental
+ * atomic enthalpies of formation are taken from JANAF, Tajti (JANAF, but
+ * carbon from Tajti et al.), or ATcT (second index). Entries for which
+ * the atomic data is not available are set to nan.  */
+struct G4Variants {
+   enum EvibTreatment { HORR=0, NICOLAIDES=1, NEVIB=2 };
+   enum AtomicReference { JANAF=0, TAJTI=1, ATCT=2, NREF=3 };
+   G4Method method; /*!< Method of the report.  */
+   double scalingFreqFact; /*!< Effective frequency factor (default or user-defined).  */
+   double A; /*!< Effective HLC constant A.  */
+   double alpha; /*!< Effective alpha.  */
+   double g4Energy; /*!< G4 energy at 0 K, in a.u.; common to all the variants.  */
+   double lclZPE; /*!< in a.u.  */
+   double scaledZPE; /*!< in a.u.  */
+   double evib[NEVIB]; /*!< Vibrational energy (without ZPE), in a.u.  */
+   double g4Enthalpy0K[NEVIB]; /*!< G4 enthalpy, in a.u.  */
+   double deltaHf298K[NEVIB][NREF]; /*!< Delta H_f(298.15 K), atomization reactions, in kJ mol-1.  */
+};
 /* ************************************************************************** */
 /** This class computes the G4 energy of a molecule. The std method
  * follows exactly the recipe described in 
  * L. A. Curtiss, P. C. Redfern, and K. Krishnan, J. Chem. Phys., 126 (2007) 084108
  * (hereafter [curtiss2007]). 
  * The mp2 method is a variant proposed in the Laboratory of Organic
- * Physical Chemistry.  */
+ * Physical Chemistry.
+ * Compute() does not write to the screen, and the class does not share
+ * mutable state between instances; hence, different instances can be used
+ * concurrently (one per thread). Errors and warnings found during
+ * Compute() are saved, and can be displayed later with DisplayMessages().
+ * The results are computed lazily: the setters (and the Use* toggles) only
+ * mark the terms that depend on them as dirty, and the getters call Compute()
+ * when needed. The combination of the raw energies (exp(-alpha)) is redone
+ * only when alpha changes, and the vibrational energies (one exponential per
+ * mode) only when the frequency factor changes; the remaining terms (HLC,
+ * enthalpies, atomic sums) are cheap, and are recomputed every time.  */
 class CalculateG4 {
 /* ************************************************************************** */
 public:
 /* ************************************************************************** */
    CalculateG4(RawG4sData &data,int vlvl=1);
-   /**  Function to manually compute the thermodynamics; it is called by the constructor,
-    * so it might be useful for computind more than one variant (selecting Tajti, Nicolaides,
-    * etc. */
+   /** Computes the thermodynamics of the currently selected variant. Only the
+    * terms whose inputs changed since the last call are recomputed; if nothing
+    * changed, it returns immediately. The getters call this function when
+    * needed, hence, calling it explicitly is only required for collecting
+    * the messages (see ComputeOK and DisplayMessages).  */
    void Compute();
+   /** Marks all the terms as dirty. Call this if the RawG4sData object that
+    * was passed to the constructor is modified.  */
+   void Invalidate() { dirty=DIRTYALL; }
+   /** Computes, in a single pass, the results of all the combinations of
+    * HO-RR/Nicolaides and JANAF/Tajti/ATcT. The terms common to all the
+    * variants (G4 energy, atomic sums, etc.) are computed only once. The
+    * results are identical to the ones obtained by toggling
+    * UseNicolaidesCorrection, UseTajtiCorrection, and UseArgonneData, and
+    * calling Compute() for every combination. After the call, the getters
+    * return the values corresponding to the currently selected variant.  */
+   G4Variants ComputeAllVariants();
+   /** Returns false if the last call to Compute() found an error (e.g. unknown
+    * method, or atoms without atomic data).  */
+   bool ComputeOK() const { return errorMessages.size()==0; }
+   const vector<string> &ErrorMessages() const { return errorMessages; }
+   const vector<string> &WarningMessages() const { return warningMessages; }
+   /** Displays the warnings and errors found during the last call to Compute().  */
+   void DisplayMessages() const;
+   /** Displays the user-defined parameters (e.g. frequency factor, A, alpha, etc.)  */
+   void DisplayParameters() const;
    /** Returns the G4 energy, in hartrees (this should coincide with the
     * g09 output ---G4(0K)---, when using std method.  */
-   double G4Energy() const { return g4Energy;}
+   double G4Energy() { UpdateIfDirty(); return g4Energy;}
    /** Returns the G4 enthalpy, in hartres. This should coincide
     * with the g09 output ---G4 Enthalpy---, when using std method.   */
-   double G4Enthalpy0K() const { return g4Enthalpy0K;}
+   double G4Enthalpy0K() { UpdateIfDirty(); return g4Enthalpy0K;}
    /** Returns the Delta H f, using atomization reactions, at 0 K. in \f$kJ mol^{-1}\f$  */
-   double DeltaHf0KAtomization() const { return deltaHf0KAtomization*G4AtomicProperties::hartree2kJPerMole; }
+   double DeltaHf0KAtomization() { UpdateIfDirty(); return deltaHf0KAtomization*G4AtomicProperties::hartree2kJPerMole; }
    /** Returns the Delta H f, using atomization reactions, at 298.15 K. in \f$kJ mol^{-1}\f$ */
-   double DeltaHf298KAtomization() const { return deltaHf298KAtomization*G4AtomicProperties::hartree2kJPerMole; }
-   void UseNicolaidesCorrection(bool unc) { useNicolaidesCorr=unc; }
-   void UseTajtiCorrection(bool utc) { useTajtiCorr=utc; }
-   void UseArgonneData(bool uad) {  useArgonneData=uad; }
-   double LclZPE() { return lclZPE; }
-   double ScaledZPE() { return (rd->zpe)*scalingFreqFact; }
+   double DeltaHf298KAtomization() { UpdateIfDirty(); return deltaHf298KAtomization*G4AtomicProperties::hartree2kJPerMole; }
+   void UseNicolaidesCorrection(bool unc) { useNicolaidesCorr=unc; dirty|=DIRTYRESULTS; }
+   void UseTajtiCorrection(bool utc) { useTajtiCorr=utc; dirty|=DIRTYRESULTS; }
+   void UseArgonneData(bool uad) {  useArgonneData=uad; dirty|=DIRTYRESULTS; }
+   double LclZPE() { UpdateIfDirty(); return lclZPE; }
+   double ScaledZPE() { UpdateIfDirty(); return (rd->zpe)*scalingFreqFact; }
+   /** Computes the terms of Delta H_f(298.15 K) (atomization reactions) that
+    * do not depend on the G4 parameters, i.e. the atomic data of the reference
+    * ref, Erot, Etrans, and PV (in hartrees). The terms are accumulated in the
+    * same order as in ComputeAllVariants. Returns false if some atom of rd
+    * has no atomic data for ref.  */
+   static bool ComputeAtomizationOffset(const RawG4sData &rd,\
+         const G4Variants::AtomicReference ref,double &off);
    void SetScalingFreqencyFactor(const double ff);
-   double GetScalingFrequencyFactor() {return scalingFreqFact;}
+   double GetScalingFrequencyFactor() { UpdateIfDirty(); return scalingFreqFact; }
    void SetConstantA(const double aa);
-   double GetConstantA() {return A;}
+   double GetConstantA() { UpdateIfDirty(); return A; }
    void SetAlpha(const double aa);
-   double ScalingFreqencyFactor(void) { return scalingFreqFact; }
+   double ScalingFreqencyFactor(void) { UpdateIfDirty(); return scalingFreqFact; }
    void SetT1Diag(const double t1);
    void SetConstantM(const double mm);
    void SetLHGap(const double gap);
@@ -92,6 +159,13 @@ protected:
 /* ************************************************************************** */
    RawG4sData* rd;
    CalculateG4(); //Forbidden to construct without data.
+   /** Bits of dirty. DIRTYRESULTS is set by every setter; DIRTYECOMB (the
+    * combination of the raw energies) by SetAlpha, and DIRTYEVIB (the
+    * vibrational energies and lclZPE) by SetScalingFreqencyFactor.  */
+   enum DirtyFlags { DIRTYRESULTS=1, DIRTYECOMB=2, DIRTYEVIB=4, DIRTYALL=7 };
+   void UpdateIfDirty() { if ( dirty&DIRTYRESULTS ) { Compute(); } }
+   /** Sets all the results to nan (used when the safety checks fail).  */
+   void SetResultsToNaN();
    /** Future compatibility function. Currently, it returns zero. It should compute the spin-orbit correction
     * for atoms and a few non-closed-shell molecules.  */
    double GetSpinOrbitCorr();
@@ -101,33 +175,53 @@ protected:
    double GetLHGapTerm();
    int GetValenceElectrons();
    int GetTotalNumberOfElectrons();
+   /** Computes eComb, i.e. the G4 energy without the HLC, multireference,
+    * and ZPE terms.  */
+   void ComputeCombinedEnergy();
+   /** Computes the G4 energy at 0 K; eComb is recomputed only if it is dirty.  */
    void ComputeG4Energy();
    void ComputeG4Enthalpies0Kand298K();
    void ComputeDeltaHf298KAtomization();
    void PrintWarnings();
    void SetupVars();
-   void ChooseFrequencyFactor();
-   void ChooseParameterA();
-   void SafetyChecks();
-   /** Returns the experimental atomic enthalpy of formation at 0 K.
-    * This function selects the appropriate value depending on
-    * the recommendations, i.e. JANAF values are used, unless
-    * otherwise specified (e.g. using Tajti carbon data, or
-    * Argonne tables. Default: JANAF. In this version, only JANAF
-    * values are returned. Reimplement this to include other
-    * corrections or variants.  */
-   double GetDeltaHfAtom0KExp(int nAt);
-   double GetDeltaHf298KmDeltaHf0KExp(int nAt);
+   /** Saves the error messages for a method without parameters (unless
+    * the user provided the frequency factor and A).  */
+   void ReportUnknownMethod();
+   bool SafetyChecks();
+   /** Returns true if all atoms of the molecule are known and have the
+    * atomic data required by the current variant.  */
+   bool CheckAtomicData();
+   /** Same as above, but the availability of the ATcT data is returned in atctok,
+    * and it is not considered an error.  */
+   bool CheckAtomicData(bool &atctok);
+   /** Appends msg to the list of errors, unless it is already there, so
+    * that a failing report displays each message once.  */
+   void AddErrorMessage(const string &msg) { AddUniqueMessage(msg,errorMessages); }
+   void AddWarningMessage(const string &msg) { AddUniqueMessage(msg,warningMessages); }
+   static void AddUniqueMessage(const string &msg,vector<string> &list) {
+      if ( std::find(list.begin(),list.end(),msg)==list.end() ) { list.push_back(msg); }
+   }
+   /** Returns the source of the experimental atomic enthalpies of formation
+    * at 0 K. JANAF values are used, unless otherwise specified (e.g. using
+    * Tajti carbon data, or Argonne tables). Reimplement this to include
+    * other corrections or variants.  */
+   G4AtomicProperties::DeltaHfSource GetDeltaHfSource() const;
    /** This function computes the vibrational energy WITHOUT
-    * the ZPE.  */
+    * the ZPE. The HO-RR and Nicolaides energies are recomputed only if
+    * they are dirty (see UpdateEvibCache).  */
    void ComputeEvib();
+   /** Computes evibJHORR, evibJNicolaides, and lclZPE if they are dirty.  */
+   void UpdateEvibCache();
+   /** Computes the vibrational energy (in J/mol, without ZPE) with and without
+    * the Nicolaides correction, in the same loop. Also computes lclZPE.  */
+   void ComputeEvibHORRAndNicolaides(double &evibho,double &evibnic);
    void ComputeEnergiesFromStatTherm();
    double g4Energy; /*!< Where the G4 energy at 0 K is internally saved. In a.u.  */
    double g4Enthalpy0K; /*!< Where the G4 enthalpy at 0 K is saved.  In a.u. */
    double g4Enthalpy298K; /*!< Where the G4 enthalpy at 298 K is saved. In a.u.  */
    double deltaHf0KAtomization; /*!< Where the Delta H_f(0 K), using atomization reactions, is saved; in a.u.  */
    double deltaHf298KAtomization; /*!< Where the Delta H_f(298.15 K), using atomization reactions, is saved; in a.u.  */
-   double scalingFreqFact; /*!< Contains the frequency scaling factor. Taken from: https://cccbdb.nist.gov/vibscalejust.asp  */
+   double scalingFreqFact; /*!< Contains the frequency scaling factor (see G4Methods).  */
    double alpha; /*!< See Eq. (1) of [curtiss2007]  */
    double A; /*!< See Eq. (7), and the paragraph that follows it, of [curtiss2007].  */
    double B; /*!< See Eq. (7), and the paragraph that follows it, of [curtiss2007].  */
@@ -143,6 +237,11 @@ protected:
    double Erot; /*!< Rotational energy, in a.u.  */
    double Etrans; /*!< Translational energy, in a.u.  */
    double PV; /*!< PV term, in a.u.  */
+   G4VibKernel vibk; /*!< Computes Evib and the ZPE.  */
+   double evibJHORR; /*!< Cached HO-RR vibrational energy, in Joules/mol.  */
+   double evibJNicolaides; /*!< Cached vibrational energy with the Nicolaides correction, in Joules/mol.  */
+   double eComb; /*!< Cached combination of the raw energies (see ComputeCombinedEnergy), in a.u.  */
+   unsigned int dirty; /*!< Terms that must be recomputed (see DirtyFlags).  */
    double lclZPE; /*!< Experimental/test/trial zero point energy; currently not working.  */
    bool useNicolaidesCorr;
    bool useTajtiCorr;
@@ -155,6 +254,8 @@ protected:
    bool useLHGap;
    bool usrConstantG;
    int verboseLevel;
+   vector<string> errorMessages;
+   vector<string> warningMessages;
 /* ************************************************************************** */
 };
 /* ************************************************************************** */
@@ -50,6 +50,10 @@ using std::ofstream;
 #include <iomanip>
 using std::scientific;
 using std::setprecision;
+#include <algorithm>
+#include <dirent.h>
+#include <glob.h>
+#include <sys/stat.h>
 #include "fileutils.h"
 #include "screenutils.h"
 #include "stringtools.h"
@@ -452,3 +456,61 @@ bool FileUtils::HasWindowsNewLines(const string &fname) {
 }
 
 
+bool FileUtils::IsDirectory(const string &path) {
+   struct stat sb;
+   if ( stat(path.c_str(),&sb)!=0 ) { return false; }
+   return S_ISDIR(sb.st_mode);
+}
+vector<string> FileUtils::ListFilesInDirectory(const string &dirname,const string &suffix) {
+   vector<string> res;
+   DIR* dir=opendir(dirname.c_str());
+   if ( dir==NULL ) {
+      ScreenUtils::DisplayErrorMessage(string("Could not open the directory ")+dirname);
+      cout << __FILE__ << ", line: " << __LINE__ << endl;
+      return res;
+   }
+   string dname=dirname;
+   if ( dname.length()>0 && dname[dname.length()-1]!='/' ) { dname+='/'; }
+   struct dirent* ent;
+   string name;
+   size_t ls=suffix.length();
+   while ( (ent=readdir(dir))!=NULL ) {
+      name=ent->d_name;
+      if ( name.length()<ls ) { continue; }
+      if ( name.compare(name.length()-ls,ls,suffix)!=0 ) { continue; }
+      name.insert(0,dname);
+      struct stat sb;
+      if ( stat(name.c_str(),&sb)!=0 || !S_ISREG(sb.st_mode) ) { continue; }
+      res.push_back(name);
+   }
+   closedir(dir);
+   std::sort(res.begin(),res.end());
+   return res;
+}
+vector<string> FileUtils::ExpandGlobPattern(const string &pattern) {
+   vector<string> res;
+   glob_t gl;
+   if ( glob(pattern.c_str(),0,NULL,&gl)==0 ) {
+      for ( size_t i=0 ; i<gl.gl_pathc ; ++i ) { res.push_back(string(gl.gl_pathv[i])); }
+   }
+   globfree(&gl);
+   return res;
+}
+vector<string> FileUtils::ReadListOfFileNames(const string &fname) {
+   vector<string> res;
+   ifstream ifil(fname.c_str());
+   if ( !ifil.good() ) {
+      ScreenUtils::DisplayErrorMessage(string("Could not open the file ")+fname);
+      cout << __FILE__ << ", line: " << __LINE__ << endl;
+      ifil.close();
+      return res;
+   }
+   string line;
+   while ( std::getline(ifil,line) ) {
+      StringTools::RemoveSpacesLeftAndRight(line);
+      if ( line.length()==0 || line[0]=='#' ) { continue; }
+      res.push_back(line);
+   }
+   ifil.close();
+   return res;
+}
@@ -129,6 +129,20 @@ public:
    static bool ExtensionMatches(const string &fname,const string ext);
 /* ************************************************************************** */
    static bool HasWindowsNewLines(const string &fname);
+/* ************************************************************************** */
+   /** Returns true if path exists and it is a directory.  */
+   static bool IsDirectory(const string &path);
+   /** Returns the (sorted) list of regular files contained in the directory
+    * dirname whose names end with suffix. The returned names include
+    * the directory (i.e. dirname/file). If suffix is empty, all
+    * regular files are returned.  */
+   static vector<string> ListFilesInDirectory(const string &dirname,const string &suffix="");
+   /** Expands the shell-like pattern (wildcards *, ?, [...]) and returns the
+    * (sorted) list of matching names. Returns an empty vector if nothing matches.  */
+   static vector<string> ExpandGlobPattern(const string &pattern);
+   /** Reads a list of file names, one per line. Empty lines, and lines
+    * starting with '#', are ignored; leading and trailing spaces are removed.  */
+   static vector<string> ReadListOfFileNames(const string &fname);
 /* ************************************************************************** */
 protected:
 /* ************************************************************************** */
@@ -0,0 +1,414 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cstdlib>
+#include <iostream>
+using std::cout;
+using std::endl;
+#include <fstream>
+using std::ifstream;
+using std::ofstream;
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <memory>
+using std::shared_ptr;
+#include <cmath>
+#include "g09logextractor.h"
+#include "screenutils.h"
+#include "stringtools.h"
+#include "atom.h"
+#include "molecule.h"
+#include "moleculeinertiatensor.h"
+
+G09LogExtractor::G09LogExtractor() {
+   Init();
+}
+G09LogExtractor::G09LogExtractor(const string &logname,const string &mthd,\
+      RawG4sData &data) : G09LogExtractor() {
+   imsetup=Extract(logname,mthd,data);
+}
+void G09LogExtractor::Init() {
+   logName="";
+   imsetup=false;
+   multiplicity=0;
+   nElAlpha=nElBeta=-1;
+   haveZPE=false;
+   zpe=0.0e0;
+   molecularMass=0.0e0;
+   rotSymmetryNumber=0;
+   rotConstants.clear();
+   freqLines.clear();
+   archive.clear();
+   currBlock.clear();
+   inArchive=false;
+   stdOrientState=0;
+   lastAtNum.clear();
+   currAtNum.clear();
+   lastCoords.clear();
+   currCoords.clear();
+}
+bool G09LogExtractor::Extract(const string &logname,const string &mthd,RawG4sData &data) {
+   Init();
+   logName=logname;
+   ifstream ifil(logname.c_str());
+   if ( !ifil.good() ) {
+      ScreenUtils::DisplayErrorFileNotOpen(logname);
+      ifil.close();
+      return false;
+   }
+   string line;
+   while ( std::getline(ifil,line) ) { ProcessLine(line); }
+   ifil.close();
+   if ( inArchive ) {
+      ScreenUtils::DisplayErrorMessage("Error: Incomplete blocks!");
+      return false;
+   }
+   bool ok=true;
+   if ( multiplicity!=1 ) {
+      ScreenUtils::DisplayErrorMessage("The current version cannot be used to study"
+            " open-shell systems nor excited states!");
+      ok=false;
+   }
+   if ( lastAtNum.size()<2 ) {
+      ScreenUtils::DisplayErrorMessage("The current version cannot compute properties"
+            " of single atoms (or no Standard orientation was found)!");
+      return false;
+   }
+   data.atomsInMolecule=GetAtomsInMolecule();
+   if ( !data.SetupComposition() ) {
+      data.DisplayMessages();
+      ok=false;
+   }
+   data.nElAlpha=nElAlpha;
+   data.nElBeta=nElBeta;
+   if ( nElAlpha<0 || nElBeta<0 ) {
+      ScreenUtils::DisplayErrorMessage("The number of alpha/beta electrons was not found!");
+      ok=false;
+   }
+   data.method=mthd;
+   StringTools::ToLower(data.method);
+   if ( !StringTools::StartsWith(data.method,"g4-") ) { data.method.insert(0,"g4-"); }
+   if ( !data.SetupMethod() ) {
+      ScreenUtils::DisplayWarningMessage(data.WarningMessages().back());
+   }
+   data.islinear=IsLinearGeometry();
+   if ( haveZPE ) {
+      data.zpe=zpe;
+   } else {
+      ScreenUtils::DisplayErrorMessage("Zero-point correction not found!");
+      ok=false;
+   }
+   ok=FillFrequencies(data) && ok;
+   ok=FillStepEnergies(data) && ok;
+   data.molecularMass=molecularMass;
+   data.rotSymmetryNumber=rotSymmetryNumber;
+   data.rotConstants=rotConstants;
+   if ( nElAlpha!=nElBeta ) {
+      ScreenUtils::DisplayWarningMessage("Only closed shell molecules can be correctly analized!");
+      ok=false;
+   }
+   data.imsetup=ok;
+   return ok;
+}
+void G09LogExtractor::ProcessLine(const string &line) {
+   if ( inArchive ) {
+      currBlock+=((line.size()>0 && line[0]==' ') ? line.substr(1) : line);
+      if ( line.find('@')!=string::npos ) { CloseArchiveBlock(); }
+      return;
+   }
+   if ( stdOrientState!=0 ) {
+      if ( stdOrientState>0 ) {
+         --stdOrientState;
+         if ( stdOrientState==0 ) { stdOrientState=-1; }
+         return;
+      }
+      if ( !ReadStandardOrientationLine(line) ) {
+         stdOrientState=0;
+         lastAtNum=currAtNum;
+         lastCoords=currCoords;
+      }
+      return;
+   }
+   if ( line.find("1\\1\\")!=string::npos ) {
+      inArchive=true;
+      currBlock.clear();
+      ProcessLine(line);
+      return;
+   }
+   if ( line.find("Standard orientation:")!=string::npos ) {
+      stdOrientState=4;
+      currAtNum.clear();
+      currCoords.clear();
+      return;
+   }
+   size_t pos=line.find("Frequencies --");
+   if ( pos!=string::npos ) {
+      freqLines.push_back(line.substr(pos+14));
+      return;
+   }
+   if ( multiplicity==0 ) {
+      pos=line.find("Multiplicity =");
+      if ( pos!=string::npos ) {
+         multiplicity=std::atoi(line.c_str()+pos+14);
+         return;
+      }
+   }
+   pos=line.find(" alpha electrons");
+   if ( pos!=string::npos ) {
+      std::istringstream iss(line);
+      string dummy;
+      iss >> nElAlpha >> dummy >> dummy >> nElBeta;
+      return;
+   }
+   if ( molecularMass<=0.0e0 ) {
+      pos=line.find("Molecular mass:");
+      if ( pos!=string::npos ) {
+         molecularMass=std::strtod(line.c_str()+pos+15,nullptr);
+         return;
+      }
+   }
+   /* The rotational constants printed in the Thermochemistry section
+    * follow the symmetry number (and are printed with the same units
+    * for linear molecules, as 'Rotational constant (GHZ):').  */
+   if ( rotSymmetryNumber==0 ) {
+      pos=line.find("Rotational symmetry number");
+      if ( pos!=string::npos ) {
+         rotSymmetryNumber=std::atoi(line.c_str()+pos+26);
+         return;
+      }
+   } else if ( rotConstants.size()==0 ) {
+      pos=line.find("Rotational constant");
+      if ( pos!=string::npos ) {
+         pos=line.find(':',pos);
+         if ( pos==string::npos ) { return; }
+         std::istringstream iss(line.substr(pos+1));
+         string s;
+         char* endp;
+         double val;
+         while ( iss >> s ) {
+            val=std::strtod(s.c_str(),&endp);
+            if ( endp==s.c_str() ) { break; }
+            rotConstants.push_back(val);
+         }
+         return;
+      }
+   }
+   if ( !haveZPE ) {
+      pos=line.find("Zero-point correction=");
+      if ( pos!=string::npos ) {
+         zpe=std::strtod(line.c_str()+pos+22,nullptr);
+         haveZPE=true;
+      }
+   }
+}
+void G09LogExtractor::CloseArchiveBlock() {
+   inArchive=false;
+   currBlock.erase(std::remove(currBlock.begin(),currBlock.end(),'@'),currBlock.end());
+   vector<string> items;
+   size_t beg=0,end;
+   do {
+      end=currBlock.find('\\',beg);
+      items.push_back(currBlock.substr(beg,(end==string::npos ? string::npos : end-beg)));
+      beg=end+1;
+   } while ( end!=string::npos );
+   archive.push_back(items);
+   currBlock.clear();
+}
+bool G09LogExtractor::ReadStandardOrientationLine(const string &line) {
+   if ( StringTools::StartsWith(line," ----") ) { return false; }
+   std::istringstream iss(line);
+   int idx,an,tp;
+   vector<double> x(3);
+   if ( !(iss >> idx >> an >> tp >> x[0] >> x[1] >> x[2]) ) { return false; }
+   currAtNum.push_back(an);
+   currCoords.push_back(x);
+   return true;
+}
+bool G09LogExtractor::FillFrequencies(RawG4sData &data) {
+   if ( freqLines.size()==0 ) {
+      ScreenUtils::DisplayErrorMessage("No frequencies were found!");
+      return false;
+   }
+   /* As in the script: repeated lines are discarded, and the lines
+    * are sorted using their first frequency.  */
+   vector<vector<double> > blk;
+   vector<vector<string> > tok;
+   for ( size_t i=0 ; i<freqLines.size() ; ++i ) {
+      std::istringstream iss(freqLines[i]);
+      vector<string> t;
+      string s;
+      while ( iss >> s ) { t.push_back(s); }
+      if ( t.size()==0 || std::find(tok.begin(),tok.end(),t)!=tok.end() ) { continue; }
+      vector<double> f(t.size());
+      for ( size_t j=0 ; j<t.size() ; ++j ) { f[j]=std::strtod(t[j].c_str(),nullptr); }
+      tok.push_back(t);
+      blk.push_back(f);
+   }
+   std::stable_sort(blk.begin(),blk.end(),\
+         [](const vector<double> &a,const vector<double> &b) { return a[0]<b[0]; });
+   bool ok=true;
+   data.frequencies.clear();
+   for ( size_t i=0 ; i<blk.size() ; ++i ) {
+      for ( size_t j=0 ; j<blk[i].size() ; ++j ) {
+         if ( blk[i][j]<0.0e0 ) {
+            ok=false;
+            ScreenUtils::DisplayErrorMessage("Imaginary frequency found!");
+            cout << __FILE__ << ", fnc: " << __FUNCTION__ << ", line: " << __LINE__ << '\n';
+         }
+         data.frequencies.push_back(blk[i][j]);
+      }
+   }
+   return ok;
+}
+bool G09LogExtractor::GetArchiveValue(size_t blk,const string &key,double &val,\
+      const string &msg) const {
+   if ( blk<archive.size() ) {
+      string kk=key+string("=");
+      for ( size_t i=0 ; i<archive[blk].size() ; ++i ) {
+         const string &it=archive[blk][i];
+         if ( it.find('#')!=string::npos ) { continue; }
+         if ( StringTools::StartsWith(it,kk) ) {
+            val=std::strtod(it.c_str()+kk.size(),nullptr);
+            return true;
+         }
+      }
+   }
+   ScreenUtils::DisplayErrorMessage(key+string(" not found (")+msg+string(")!"));
+   return false;
+}
+bool G09LogExtractor::FillStepEnergies(RawG4sData &data) {
+   if ( archive.size()<8 ) {
+      ScreenUtils::DisplayErrorMessage(string("Only ")+std::to_string(archive.size())+\
+            string(" archive blocks were found (8 are needed)!"));
+      return false;
+   }
+   bool ok=true;
+   ok=GetArchiveValue(2,"MP2",data.mp2gtbas1,"Step3") && ok;
+   ok=GetArchiveValue(2,"MP4SDTQ",data.mp4gtbas1,"Step3") && ok;
+   ok=GetArchiveValue(2,"CCSD(T)",data.ccsdtg3bas1,"Step3") && ok;
+   ok=GetArchiveValue(3,"MP2",data.mp2gtbas2,"Step4") && ok;
+   ok=GetArchiveValue(3,"MP4SDTQ",data.mp4gtbas2,"Step4") && ok;
+   ok=GetArchiveValue(4,"MP2",data.mp2gtbas3,"Step5") && ok;
+   ok=GetArchiveValue(4,"MP4SDTQ",data.mp4gtbas3,"Step5") && ok;
+   ok=GetArchiveValue(5,"HF",data.hfgtlargexp,"Step6") && ok;
+   ok=GetArchiveValue(5,"MP2",data.mp2gtlargexp,"Step6") && ok;
+   ok=GetArchiveValue(6,"HF",data.hfgfhfb1,"Step7") && ok;
+   ok=GetArchiveValue(7,"HF",data.hfgfhfb2,"Step8") && ok;
+   return ok;
+}
+bool G09LogExtractor::IsLinearGeometry() const {
+   /* Same criterion as moleculeinfo -l (see HelpersMoleculeInfo::CheckIfMoleculeIsLinear) */
+   shared_ptr<Molecule> mol=shared_ptr<Molecule>(new Molecule());
+   vector<double> x(3);
+   for ( size_t i=0 ; i<lastAtNum.size() ; ++i ) {
+      x=lastCoords[i];
+      mol->AddAtom(x,lastAtNum[i]);
+   }
+   MoleculeInertiaTensor I(mol);
+   return ( (fabs(I.Eva(0)*I.NormFactEva())<=1.0e-06) &&\
+            (fabs(I.NormFactEva()*(I.Eva(1)-I.Eva(2)))<1.0e-04) );
+}
+string G09LogExtractor::GetAtomsInMolecule() const {
+   vector<string> symb(lastAtNum.size());
+   for ( size_t i=0 ; i<lastAtNum.size() ; ++i ) {
+      symb[i]=Atom::GetAtomicSymbol(lastAtNum[i]);
+   }
+   std::sort(symb.begin(),symb.end());
+   string res;
+   for ( size_t i=0 ; i<symb.size() ; ++i ) { res+=(symb[i]+string(" ")); }
+   return res;
+}
+string G09LogExtractor::GetReportName(const string &logname) {
+   string res=logname;
+   if ( res.size()>4 ) {
+      string ext=res.substr(res.size()-4);
+      if ( ext==string(".log") || ext==string(".out") ) { res.erase(res.size()-4); }
+   }
+   res+="-ReportG09.dat";
+   return res;
+}
+bool G09LogExtractor::WriteReport(const string &repname,const RawG4sData &data) const {
+   ofstream ofil(repname.c_str());
+   if ( !ofil.good() ) {
+      ScreenUtils::DisplayErrorFileNotOpen(repname);
+      ofil.close();
+      return false;
+   }
+   ofil << std::setprecision(12);
+   ofil << "#This file contain sthe information extracted from the Gaussian09\n";
+   ofil << "# G4 calculation.\n";
+   ofil << "#\n#" << logName << ":\n#\n";
+   ofil << "ATOMS_IN_MOLECULE\n" << data.atomsInMolecule << '\n';
+   ofil << "ALPHA_ELECTRONS\n" << data.nElAlpha << '\n';
+   ofil << "BETA_ELECTRONS\n" << data.nElBeta << '\n';
+   ofil << "METHOD\n" << data.method << '\n';
+   ofil << "IS_LINEAR\n" << (data.islinear ? 'y' : 'n') << '\n';
+   ofil << "ZeroPoint\n" << data.zpe << '\n';
+   ofil << "FREQUENCIES\n" << data.frequencies.size() << '\n';
+   for ( size_t i=0 ; i<data.frequencies.size() ; ++i ) { ofil << data.frequencies[i] << '\n'; }
+   ofil << "#\n#Step3:\n#\n";
+   ofil << "MP2\n" << data.mp2gtbas1 << '\n';
+   ofil << "MP4SDTQ\n" << data.mp4gtbas1 << '\n';
+   ofil << "CCSD(T)\n" << data.ccsdtg3bas1 << '\n';
+   ofil << "#\n#Step4:\n#\n";
+   ofil << "MP2\n" << data.mp2gtbas2 << '\n';
+   ofil << "MP4SDTQ\n" << data.mp4gtbas2 << '\n';
+   ofil << "#\n#Step5:\n#\n";
+   ofil << "MP2\n" << data.mp2gtbas3 << '\n';
+   ofil << "MP4SDTQ\n" << data.mp4gtbas3 << '\n';
+   ofil << "#\n#Step6:\n#\n";
+   ofil << "HF\n" << data.hfgtlargexp << '\n';
+   ofil << "MP2\n" << data.mp2gtlargexp << '\n';
+   ofil << "#\n#Step7:\n#\n";
+   ofil << "HF\n" << data.hfgfhfb1 << '\n';
+   ofil << "#\n#Step8:\n#\n";
+   ofil << "HF\n" << data.hfgfhfb2 << '\n';
+   if ( data.HasThermochemistryData() ) {
+      ofil << "#\n#Thermochemistry (Step2):\n#\n";
+      ofil << "MOLECULAR_MASS\n" << data.molecularMass << '\n';
+      ofil << "ROTATIONAL_SYMMETRY_NUMBER\n" << data.rotSymmetryNumber << '\n';
+      ofil << "ROTATIONAL_CONSTANTS_GHZ\n" << data.rotConstants.size() << '\n';
+      for ( size_t i=0 ; i<data.rotConstants.size() ; ++i ) { ofil << data.rotConstants[i] << '\n'; }
+   }
+   ofil.close();
+   return true;
+}
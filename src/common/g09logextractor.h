@@ -0,0 +1,122 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _G09LOGEXTRACTOR_H_
+#define _G09LOGEXTRACTOR_H_
+#include <vector>
+using std::vector;
+#include <string>
+using std::string;
+#include "rawg4sdata.h"
+
+/* ************************************************************************** */
+/** This class extracts, in a single pass, the information of a Gaussian09
+ * log file (wherein the eight steps of a G4-XXX calculation were requested)
+ * that is needed by CalculateG4. It replaces the grep/sed/awk pipeline
+ * of the script g4-nitro-closed-xxx (see ../../scripts/g4-nitro-closed-xxx.sh),
+ * which reads the log file more than 15 times. The data is directly
+ * loaded into a RawG4sData object; the report (*-ReportG09.dat) can
+ * also be written (WriteReport), with the same format the script uses.
+ * The archive blocks (from '1\1' to '@') are numbered as in the script,
+ * i.e. the blocks 3-8 hold the energies of the steps 3-8.  */
+class G09LogExtractor {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   G09LogExtractor();
+   /** mthd is the G4 variant, e.g. "b3lyp" or "g4-b3lyp" (see the option -m
+    * of the script g4-nitro-closed-xxx).  */
+   G09LogExtractor(const string &logname,const string &mthd,RawG4sData &data);
+   bool Extract(const string &logname,const string &mthd,RawG4sData &data);
+   bool ImSetup() const { return imsetup; }
+   /** Writes the report (usually named baseName-ReportG09.dat), using
+    * the same format of the script g4-nitro-closed-xxx.  */
+   bool WriteReport(const string &repname,const RawG4sData &data) const;
+   /** Returns the name of the report, as created by the script
+    * g4-nitro-closed-xxx, i.e. baseName-ReportG09.dat  */
+   static string GetReportName(const string &logname);
+   int Multiplicity() const { return multiplicity; }
+   size_t NumberOfArchiveBlocks() const { return archive.size(); }
+   /** Atomic numbers of the last Standard orientation.  */
+   const vector<int>& AtomicNumbers() const { return lastAtNum; }
+   /** Coordinates (Angstroms) of the last Standard orientation.  */
+   const vector<vector<double> >& Coordinates() const { return lastCoords; }
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   void Init();
+   void ProcessLine(const string &line);
+   void CloseArchiveBlock();
+   bool ReadStandardOrientationLine(const string &line);
+   bool FillFrequencies(RawG4sData &data);
+   bool FillStepEnergies(RawG4sData &data);
+   bool GetArchiveValue(size_t blk,const string &key,double &val,\
+         const string &msg) const;
+   bool IsLinearGeometry() const;
+   string GetAtomsInMolecule() const;
+   string logName;
+   bool imsetup;
+   int multiplicity;
+   int nElAlpha,nElBeta;
+   bool haveZPE;
+   double zpe;
+   /** From the first Thermochemistry section (optional; see RawG4sData).  */
+   double molecularMass;
+   int rotSymmetryNumber;
+   vector<double> rotConstants;
+   /** Each "Frequencies --" line (without the label). Repeated lines are discarded.  */
+   vector<string> freqLines;
+   /** Archive blocks. Each block holds its "key=value" items (split at '\').  */
+   vector<vector<string> > archive;
+   string currBlock;
+   bool inArchive;
+   /** Number of header lines still to skip (>0) after a "Standard orientation:"
+    * line; -1 while the coordinates are being read; 0 otherwise.  */
+   int stdOrientState;
+   vector<int> lastAtNum,currAtNum;
+   vector<vector<double> > lastCoords,currCoords;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _G09LOGEXTRACTOR_H_ */
+
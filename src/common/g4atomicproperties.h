@@ -41,61 +41,477 @@
 */
 #ifndef _G4ATOMICPROPERTIES_H_
 #define _G4ATOMICPROPERTIES_H_
-#include <vector>
-using std::vector;
 #include <string>
 using std::string;
 
 /* ************************************************************************** */
+/** Atomic reference data used in the atomization reactions. All the
+ * tables are indexed by the atomic number (entry 0 is unused) and are
+ * stored already converted to hartrees. The getters do not print anything;
+ * out of range atomic numbers map to entry 0 (zero data, empty mask),
+ * so callers must check DataMask (or HasAtomizationData/HasATcTData)
+ * once per molecule, before accumulating the atomic terms.  */
 class G4AtomicProperties {
 /* ************************************************************************** */
 public:
 /* ************************************************************************** */
-   static double GetG4Energy(const int n,const string &mthd); // in hartrees
-   static double GetG4StdEnergy0K(const int n); // in hartrees
-   static double GetG4StdEnthalpy0K(const int n); // in hartrees
-   static double GetG4StdH298mH0(const int n); // in hartrees
-   static double GetDeltaHf0KJANAF(const int n); // in hartrees
-   static double GetDeltaHf0KTajti(const int n); // in hartrees
-   static double GetDeltaHf298KNISTJANAF(const int n); // in hartrees
-   static double GetDeltaHf0KATcT(const int n); // in hartrees
+   /** Sources of the experimental atomic enthalpies of formation at 0 K.
+    * Same order as G4Variants::AtomicReference.  */
+   enum DeltaHfSource { JANAF=0, TAJTI=1, ATCT=2, NSOURCES=3 };
+   /** Bits of the validity mask (see DataMask).  */
+   enum DataBits { ATOMIZATIONDATA=1, ATCTDATA=2 };
+   static constexpr int MAXZ=36;
+   static constexpr int NZ=MAXZ+1;
    static constexpr double kCalPMole2Hartree=1.0e0/627.5e0;
    static constexpr double JPMole2Hartree=1.0e0/2.6255e+06;
    static constexpr double hartree2kJPerMole=2.6255e+03;
    static constexpr double hartree2JPerMole=2.6255e+06;
    static constexpr double hartree2kCalPerMole=6.27503e+02;
+/* ************************************************************************** */
+   static double GetG4Energy(const int n,const string &mthd); // in hartrees
+   static double GetG4StdEnergy0K(const int n) { return g4std0k[ClampZ(n)]; } // in hartrees
+   static double GetG4StdEnthalpy0K(const int n) { return deltaHf0K[ClampZ(n)]; } // in hartrees
+   static double GetG4StdH298mH0(const int n) { return h298KmH0K[ClampZ(n)]; } // in hartrees
+   static double GetDeltaHf0KJANAF(const int n) { return dHf0Kexp[JANAF][ClampZ(n)]; } // in hartrees
+   static double GetDeltaHf0KTajti(const int n) { return dHf0Kexp[TAJTI][ClampZ(n)]; } // in hartrees
+   static double GetDeltaHf0KATcT(const int n) { return dHf0Kexp[ATCT][ClampZ(n)]; } // in hartrees
+   static double GetDeltaHf298KNISTJANAF(const int n) { return dHf298KExpNISTJANAF[ClampZ(n)]; } // in hartrees
+   /** Returns \f$\Delta H_f(0K)-E_0\f$ of the atom n, i.e., the
+    * contribution of one atom n to the 0 K atomization enthalpy of
+    * formation, when the atomic enthalpies are taken from src.  */
+   static double GetAtomizationOffset0K(const DeltaHfSource src,const int n) {
+      return atomizationOffset0K[src][ClampZ(n)];
+   } // in hartrees
+   /** Same as GetAtomizationOffset0K, minus the 298 K correction of
+    * the elements in their reference state (NIST-JANAF).  */
+   static double GetAtomizationOffset298K(const DeltaHfSource src,const int n) {
+      return atomizationOffset298K[src][ClampZ(n)];
+   } // in hartrees
+   /** Returns the DataBits available for the atomic number n. The masks of
+    * all the atoms of a molecule can be and-ed together, so that a single
+    * test tells whether the molecule can be processed.  */
+   static unsigned int DataMask(const int n) { return dataMask[ClampZ(n)]; }
+   /** Returns true if all the G4 std and JANAF/NIST data needed for
+    * an atomization reaction are available for atomic number n.  */
+   static bool HasAtomizationData(const int n) { return (DataMask(n)&ATOMIZATIONDATA)!=0; }
+   /** Returns true if the ATcT (Argonne) data is available for atomic number n.  */
+   static bool HasATcTData(const int n) { return (DataMask(n)&ATCTDATA)!=0; }
 /* ************************************************************************** */
 protected:
 /* ************************************************************************** */
+   /** Maps out of range atomic numbers to the (empty) entry 0.  */
+   static int ClampZ(const int n) {
+      return (static_cast<unsigned int>(n)<static_cast<unsigned int>(NZ)) ? n : 0;
+   }
    /** This are G4 energies at 0 K, for the ground state.
     * Extracted from Curtiss, Redfern, and Raghavachari, J. Chem. Phys,
     *   126 (2007) 084108, Table 1.  */
-   static vector<double> g4std0k;
+   static constexpr double g4std0k[NZ]={
+      0.0e0, // (unused)
+      -0.50142e0, // H
+      -2.90491e0, // He
+      -7.46636e0, // Li
+      -14.65765e0, // Be
+      -24.64665e0, // B
+      -37.83417e0, // C
+      -54.57367e0, // N
+      -75.04550e0, // O
+      -99.70498e0, // F
+      -128.90099e0, // Ne
+      -162.11789e0, // Na
+      -199.91204e0, // Mg
+      -242.22107e0, // Al
+      -289.23704e0, // Si
+      -341.13463e0, // P
+      -397.98018e0, // S
+      -460.01505e0, // Cl
+      -527.40045e0, // Ar
+      -599.71219e0, // K
+      -677.36261e0, // Ca
+      0.0e0, // Sc
+      0.0e0, // Ti
+      0.0e0, // V
+      0.0e0, // Cr
+      0.0e0, // Mn
+      0.0e0, // Fe
+      0.0e0, // Co
+      0.0e0, // Ni
+      0.0e0, // Cu
+      0.0e0, // Zn
+      -1924.35057e0, // Ga
+      -2076.44070e0, // Ge
+      -2235.31207e0, // As
+      -2400.97797e0, // Se
+      -2573.58537e0, // Br
+      -2753.22582e0  // Kr
+   };
    /** Atomic enthalpies of formation at 0 K for atoms.
     * Extracted from Curtiss, Raghavachari, Redfern, and Pople,
     * J. Chem. Phys., 103 (1997) 1063, Table 1.  */
-   static vector<double> deltaHf0KkCal;
-   static vector<double> h298KmH0KkCal;
-   /** Experimental \f$\Delta H_f^{\circ}(0K)\f$, extracted from
-    * https://atct.anl.gov/Thermochemical%20Data/version%201.122p/index.php */
-   static vector<double> dHf0KexpATcT; // in J/mol
-   /** Experimental \f$\Delta H_f^{\circ}(0K)\f$, extracted from
-    * M. W. Chase, Jr., C. A. Davies, J. R. Downey, Jr., D. J. Frurip, R. A.
-    * McDonald, and A. N. Syverud, J. Phys. Chern. Ref. Data 14, Suppl. I
-    * (1985).*/
-   static vector<double> dHf0KexpJANAF; // in J/mol
+   static constexpr double deltaHf0K[NZ]={
+      0.0e0, // (unused)
+      51.63e0*kCalPMole2Hartree, // H
+      0.0e0, // He
+      37.69e0*kCalPMole2Hartree, // Li
+      76.48e0*kCalPMole2Hartree, // Be
+      136.20e0*kCalPMole2Hartree, // B
+      169.98e0*kCalPMole2Hartree, // C
+      112.53e0*kCalPMole2Hartree, // N
+      58.99e0*kCalPMole2Hartree, // O
+      18.47e0*kCalPMole2Hartree, // F
+      0.0e0, // Ne
+      25.69e0*kCalPMole2Hartree, // Na
+      34.87e0*kCalPMole2Hartree, // Mg
+      78.23e0*kCalPMole2Hartree, // Al
+      106.60e0*kCalPMole2Hartree, // Si
+      75.42e0*kCalPMole2Hartree, // P
+      65.66e0*kCalPMole2Hartree, // S
+      28.59e0*kCalPMole2Hartree, // Cl
+      0.0e0, // Ar
+      0.0e0, // K
+      0.0e0, // Ca
+      0.0e0, // Sc
+      0.0e0, // Ti
+      0.0e0, // V
+      0.0e0, // Cr
+      0.0e0, // Mn
+      0.0e0, // Fe
+      0.0e0, // Co
+      0.0e0, // Ni
+      0.0e0, // Cu
+      0.0e0, // Zn
+      0.0e0, // Ga
+      0.0e0, // Ge
+      0.0e0, // As
+      0.0e0, // Se
+      0.0e0, // Br
+      0.0e0  // Kr
+   };
+   static constexpr double h298KmH0K[NZ]={
+      0.0e0, // (unused)
+      1.01e0*kCalPMole2Hartree, // H
+      0.0e0, // He
+      1.10e0*kCalPMole2Hartree, // Li
+      0.46e0*kCalPMole2Hartree, // Be
+      0.29e0*kCalPMole2Hartree, // B
+      0.25e0*kCalPMole2Hartree, // C
+      1.04e0*kCalPMole2Hartree, // N
+      1.04e0*kCalPMole2Hartree, // O
+      1.05e0*kCalPMole2Hartree, // F
+      0.0e0, // Ne
+      1.54e0*kCalPMole2Hartree, // Na
+      1.19e0*kCalPMole2Hartree, // Mg
+      1.08e0*kCalPMole2Hartree, // Al
+      0.76e0*kCalPMole2Hartree, // Si
+      1.28e0*kCalPMole2Hartree, // P
+      1.05e0*kCalPMole2Hartree, // S
+      1.10e0*kCalPMole2Hartree, // Cl
+      0.0e0, // Ar
+      0.0e0, // K
+      0.0e0, // Ca
+      0.0e0, // Sc
+      0.0e0, // Ti
+      0.0e0, // V
+      0.0e0, // Cr
+      0.0e0, // Mn
+      0.0e0, // Fe
+      0.0e0, // Co
+      0.0e0, // Ni
+      0.0e0, // Cu
+      0.0e0, // Zn
+      0.0e0, // Ga
+      0.0e0, // Ge
+      0.0e0, // As
+      0.0e0, // Se
+      0.0e0, // Br
+      0.0e0  // Kr
+   };
+   /** Experimental \f$\Delta H_f^{\circ}(0K)\f$, one row per DeltaHfSource.
+    * JANAF: M. W. Chase, Jr., C. A. Davies, J. R. Downey, Jr., D. J. Frurip,
+    * R. A. McDonald, and A. N. Syverud, J. Phys. Chern. Ref. Data 14,
+    * Suppl. I (1985).
+    * Tajti: JANAF, except for C.
+    * ATcT: https://atct.anl.gov/Thermochemical%20Data/version%201.122p/index.php
+    * (last updated: 2025-04-25); only the atoms flagged with ATCTDATA.  */
+   static constexpr double dHf0Kexp[NSOURCES][NZ]={
+      { /* JANAF */
+         0.0e0, // (unused)
+         216035.0e0*JPMole2Hartree, // H
+         0.0e0, // He
+         157800.0e0*JPMole2Hartree, // Li
+         317100.0e0*JPMole2Hartree, // Be
+         569900.0e0*JPMole2Hartree, // B
+         711185.0e0*JPMole2Hartree, // C
+         470820.0e0*JPMole2Hartree, // N orig: 470820.0e0 ATcT: 470590.0e0
+         246790.0e0*JPMole2Hartree, // O
+         77400.0e0*JPMole2Hartree, // F
+         0.0e0, // Ne
+         107600.0e0*JPMole2Hartree, // Na
+         146500.0e0*JPMole2Hartree, // Mg
+         327300.0e0*JPMole2Hartree, // Al
+         452300.0e0*JPMole2Hartree, // Si
+         315600.0e0*JPMole2Hartree, // P
+         274735.0e0*JPMole2Hartree, // S
+         119600.0e0*JPMole2Hartree, // Cl
+         0.0e0, // Ar
+         0.0e0, // K
+         0.0e0, // Ca
+         0.0e0, // Sc
+         0.0e0, // Ti
+         0.0e0, // V
+         0.0e0, // Cr
+         0.0e0, // Mn
+         0.0e0, // Fe
+         0.0e0, // Co
+         0.0e0, // Ni
+         0.0e0, // Cu
+         0.0e0, // Zn
+         0.0e0, // Ga
+         0.0e0, // Ge
+         0.0e0, // As
+         0.0e0, // Se
+         0.0e0, // Br
+         0.0e0  // Kr
+      },
+      { /* Tajti */
+         0.0e0, // (unused)
+         216035.0e0*JPMole2Hartree, // H
+         0.0e0, // He
+         157800.0e0*JPMole2Hartree, // Li
+         317100.0e0*JPMole2Hartree, // Be
+         569900.0e0*JPMole2Hartree, // B
+         711790.0e0*JPMole2Hartree, // C
+         470820.0e0*JPMole2Hartree, // N
+         246790.0e0*JPMole2Hartree, // O
+         77400.0e0*JPMole2Hartree, // F
+         0.0e0, // Ne
+         107600.0e0*JPMole2Hartree, // Na
+         146500.0e0*JPMole2Hartree, // Mg
+         327300.0e0*JPMole2Hartree, // Al
+         452300.0e0*JPMole2Hartree, // Si
+         315600.0e0*JPMole2Hartree, // P
+         274735.0e0*JPMole2Hartree, // S
+         119600.0e0*JPMole2Hartree, // Cl
+         0.0e0, // Ar
+         0.0e0, // K
+         0.0e0, // Ca
+         0.0e0, // Sc
+         0.0e0, // Ti
+         0.0e0, // V
+         0.0e0, // Cr
+         0.0e0, // Mn
+         0.0e0, // Fe
+         0.0e0, // Co
+         0.0e0, // Ni
+         0.0e0, // Cu
+         0.0e0, // Zn
+         0.0e0, // Ga
+         0.0e0, // Ge
+         0.0e0, // As
+         0.0e0, // Se
+         0.0e0, // Br
+         0.0e0  // Kr
+      },
+      { /* ATcT */
+         0.0e0, // (unused)
+         216034.0e0*JPMole2Hartree, // H
+         0.0e0, // He
+         0.0e0, // Li
+         0.0e0, // Be
+         0.0e0, // B
+         711393.0e0*JPMole2Hartree, // C
+         470582.0e0*JPMole2Hartree, // N
+         246844.0e0*JPMole2Hartree, // O
+         77254.0e0*JPMole2Hartree, // F
+         0.0e0, // Ne
+         0.0e0, // Na
+         0.0e0, // Mg
+         0.0e0, // Al
+         0.0e0, // Si
+         0.0e0, // P
+         276840.0e0*JPMole2Hartree, // S
+         119621.0e0*JPMole2Hartree, // Cl
+         0.0e0, // Ar
+         0.0e0, // K
+         0.0e0, // Ca
+         0.0e0, // Sc
+         0.0e0, // Ti
+         0.0e0, // V
+         0.0e0, // Cr
+         0.0e0, // Mn
+         0.0e0, // Fe
+         0.0e0, // Co
+         0.0e0, // Ni
+         0.0e0, // Cu
+         0.0e0, // Zn
+         0.0e0, // Ga
+         0.0e0, // Ge
+         0.0e0, // As
+         0.0e0, // Se
+         0.0e0, // Br
+         0.0e0  // Kr
+      }
+   };
    /* dHf298KExpNISTJANAF has the
    //experimental Delta H  of formation at 298 K (J mol-1), as
    //taken from [A] J. Phys. Chem. 100 17460 (1996)
    //or [B] NIST-JANAF Thermochemical Tables J. Phys. Chem.
-   //Data Monograph 9, 1998, 1-1951 */
-   static vector<double> dHf298KExpNISTJANAF; //in J/mol
-   /* dHf298KExpNISTJANAF has the
-   //experimental Delta H  of formation at 298 K (J mol-1),
-   //relative to the Delta H of formation at 0 K, as
-   //taken from 
-   //https://atct.anl.gov/Thermochemical%20Data/version%201.122p/index.php  */
-   static vector<double> dHf298KExpATcT; //in J/mol
+   //Data Monograph 9, 1998, 1-1951
+   // Below, the factor 0.5 stems from the fact that H is actually H2.
+   // Thus the enthalpy of formation for a single atom contribution
+   // is half the value found in tables. */
+   static constexpr double dHf298KExpNISTJANAF[NZ]={
+      0.0e0, // (unused)
+      0.5e0*8467.0e0*JPMole2Hartree, // H
+      0.0e0, // He
+      4628.0e0*JPMole2Hartree, // Li
+      1950.0e0*JPMole2Hartree, // Be
+      1213.0e0*JPMole2Hartree, // B
+      1051.0e0*JPMole2Hartree, // C
+      0.5e0*8670.0e0*JPMole2Hartree, // N
+      0.5e0*8683.0e0*JPMole2Hartree, // O
+      0.5e0*8820.0e0*JPMole2Hartree, // F
+      0.0e0, // Ne
+      6440.0e0*JPMole2Hartree, // Na
+      5000.0e0*JPMole2Hartree, // Mg
+      4577.0e0*JPMole2Hartree, // Al
+      3217.0e0*JPMole2Hartree, // Si
+      5360.0e0*JPMole2Hartree, // P
+      4412.0e0*JPMole2Hartree, // S
+      0.5e0*9176.0e0*JPMole2Hartree, // Cl
+      0.0e0, // Ar
+      0.0e0, // K
+      0.0e0, // Ca
+      0.0e0, // Sc
+      0.0e0, // Ti
+      0.0e0, // V
+      0.0e0, // Cr
+      0.0e0, // Mn
+      0.0e0, // Fe
+      0.0e0, // Co
+      0.0e0, // Ni
+      0.0e0, // Cu
+      0.0e0, // Zn
+      0.0e0, // Ga
+      0.0e0, // Ge
+      0.0e0, // As
+      0.0e0, // Se
+      0.0e0, // Br
+      0.0e0  // Kr
+   };
+   static constexpr unsigned char dataMask[NZ]={
+      0, // (unused)
+      ATOMIZATIONDATA|ATCTDATA, // H
+      ATOMIZATIONDATA, // He
+      ATOMIZATIONDATA, // Li
+      ATOMIZATIONDATA, // Be
+      ATOMIZATIONDATA, // B
+      ATOMIZATIONDATA|ATCTDATA, // C
+      ATOMIZATIONDATA|ATCTDATA, // N
+      ATOMIZATIONDATA|ATCTDATA, // O
+      ATOMIZATIONDATA|ATCTDATA, // F
+      ATOMIZATIONDATA, // Ne
+      ATOMIZATIONDATA, // Na
+      ATOMIZATIONDATA, // Mg
+      ATOMIZATIONDATA, // Al
+      ATOMIZATIONDATA, // Si
+      ATOMIZATIONDATA, // P
+      ATOMIZATIONDATA|ATCTDATA, // S
+      ATOMIZATIONDATA|ATCTDATA, // Cl
+      0, // Ar
+      0, // K
+      0, // Ca
+      0, // Sc
+      0, // Ti
+      0, // V
+      0, // Cr
+      0, // Mn
+      0, // Fe
+      0, // Co
+      0, // Ni
+      0, // Cu
+      0, // Zn
+      0, // Ga
+      0, // Ge
+      0, // As
+      0, // Se
+      0, // Br
+      0  // Kr
+   };
+   /** atomizationOffset0K[src][n]=dHf0Kexp[src][n]-g4std0k[n]. Only the
+    * first three rows are listed; the remaining entries are zero (and
+    * their mask is empty).  */
+   static constexpr double atomizationOffset0K[NSOURCES][NZ]={
+      { /* JANAF */
+         0.0e0, dHf0Kexp[0][1]-g4std0k[1],
+         dHf0Kexp[0][2]-g4std0k[2], dHf0Kexp[0][3]-g4std0k[3],
+         dHf0Kexp[0][4]-g4std0k[4], dHf0Kexp[0][5]-g4std0k[5],
+         dHf0Kexp[0][6]-g4std0k[6], dHf0Kexp[0][7]-g4std0k[7],
+         dHf0Kexp[0][8]-g4std0k[8], dHf0Kexp[0][9]-g4std0k[9],
+         dHf0Kexp[0][10]-g4std0k[10], dHf0Kexp[0][11]-g4std0k[11],
+         dHf0Kexp[0][12]-g4std0k[12], dHf0Kexp[0][13]-g4std0k[13],
+         dHf0Kexp[0][14]-g4std0k[14], dHf0Kexp[0][15]-g4std0k[15],
+         dHf0Kexp[0][16]-g4std0k[16], dHf0Kexp[0][17]-g4std0k[17],
+         dHf0Kexp[0][18]-g4std0k[18] },
+      { /* Tajti */
+         0.0e0, dHf0Kexp[1][1]-g4std0k[1],
+         dHf0Kexp[1][2]-g4std0k[2], dHf0Kexp[1][3]-g4std0k[3],
+         dHf0Kexp[1][4]-g4std0k[4], dHf0Kexp[1][5]-g4std0k[5],
+         dHf0Kexp[1][6]-g4std0k[6], dHf0Kexp[1][7]-g4std0k[7],
+         dHf0Kexp[1][8]-g4std0k[8], dHf0Kexp[1][9]-g4std0k[9],
+         dHf0Kexp[1][10]-g4std0k[10], dHf0Kexp[1][11]-g4std0k[11],
+         dHf0Kexp[1][12]-g4std0k[12], dHf0Kexp[1][13]-g4std0k[13],
+         dHf0Kexp[1][14]-g4std0k[14], dHf0Kexp[1][15]-g4std0k[15],
+         dHf0Kexp[1][16]-g4std0k[16], dHf0Kexp[1][17]-g4std0k[17],
+         dHf0Kexp[1][18]-g4std0k[18] },
+      { /* ATcT */
+         0.0e0, dHf0Kexp[2][1]-g4std0k[1],
+         dHf0Kexp[2][2]-g4std0k[2], dHf0Kexp[2][3]-g4std0k[3],
+         dHf0Kexp[2][4]-g4std0k[4], dHf0Kexp[2][5]-g4std0k[5],
+         dHf0Kexp[2][6]-g4std0k[6], dHf0Kexp[2][7]-g4std0k[7],
+         dHf0Kexp[2][8]-g4std0k[8], dHf0Kexp[2][9]-g4std0k[9],
+         dHf0Kexp[2][10]-g4std0k[10], dHf0Kexp[2][11]-g4std0k[11],
+         dHf0Kexp[2][12]-g4std0k[12], dHf0Kexp[2][13]-g4std0k[13],
+         dHf0Kexp[2][14]-g4std0k[14], dHf0Kexp[2][15]-g4std0k[15],
+         dHf0Kexp[2][16]-g4std0k[16], dHf0Kexp[2][17]-g4std0k[17],
+         dHf0Kexp[2][18]-g4std0k[18] }
+   };
+   /** atomizationOffset298K[src][n]=atomizationOffset0K[src][n]-dHf298KExpNISTJANAF[n].  */
+   static constexpr double atomizationOffset298K[NSOURCES][NZ]={
+      { /* JANAF */
+         0.0e0, atomizationOffset0K[0][1]-dHf298KExpNISTJANAF[1],
+         atomizationOffset0K[0][2]-dHf298KExpNISTJANAF[2], atomizationOffset0K[0][3]-dHf298KExpNISTJANAF[3],
+         atomizationOffset0K[0][4]-dHf298KExpNISTJANAF[4], atomizationOffset0K[0][5]-dHf298KExpNISTJANAF[5],
+         atomizationOffset0K[0][6]-dHf298KExpNISTJANAF[6], atomizationOffset0K[0][7]-dHf298KExpNISTJANAF[7],
+         atomizationOffset0K[0][8]-dHf298KExpNISTJANAF[8], atomizationOffset0K[0][9]-dHf298KExpNISTJANAF[9],
+         atomizationOffset0K[0][10]-dHf298KExpNISTJANAF[10], atomizationOffset0K[0][11]-dHf298KExpNISTJANAF[11],
+         atomizationOffset0K[0][12]-dHf298KExpNISTJANAF[12], atomizationOffset0K[0][13]-dHf298KExpNISTJANAF[13],
+         atomizationOffset0K[0][14]-dHf298KExpNISTJANAF[14], atomizationOffset0K[0][15]-dHf298KExpNISTJANAF[15],
+         atomizationOffset0K[0][16]-dHf298KExpNISTJANAF[16], atomizationOffset0K[0][17]-dHf298KExpNISTJANAF[17],
+         atomizationOffset0K[0][18]-dHf298KExpNISTJANAF[18] },
+      { /* Tajti */
+         0.0e0, atomizationOffset0K[1][1]-dHf298KExpNISTJANAF[1],
+         atomizationOffset0K[1][2]-dHf298KExpNISTJANAF[2], atomizationOffset0K[1][3]-dHf298KExpNISTJANAF[3],
+         atomizationOffset0K[1][4]-dHf298KExpNISTJANAF[4], atomizationOffset0K[1][5]-dHf298KExpNISTJANAF[5],
+         atomizationOffset0K[1][6]-dHf298KExpNISTJANAF[6], atomizationOffset0K[1][7]-dHf298KExpNISTJANAF[7],
+         atomizationOffset0K[1][8]-dHf298KExpNISTJANAF[8], atomizationOffset0K[1][9]-dHf298KExpNISTJANAF[9],
+         atomizationOffset0K[1][10]-dHf298KExpNISTJANAF[10], atomizationOffset0K[1][11]-dHf298KExpNISTJANAF[11],
+         atomizationOffset0K[1][12]-dHf298KExpNISTJANAF[12], atomizationOffset0K[1][13]-dHf298KExpNISTJANAF[13],
+         atomizationOffset0K[1][14]-dHf298KExpNISTJANAF[14], atomizationOffset0K[1][15]-dHf298KExpNISTJANAF[15],
+         atomizationOffset0K[1][16]-dHf298KExpNISTJANAF[16], atomizationOffset0K[1][17]-dHf298KExpNISTJANAF[17],
+         atomizationOffset0K[1][18]-dHf298KExpNISTJANAF[18] },
+      { /* ATcT */
+         0.0e0, atomizationOffset0K[2][1]-dHf298KExpNISTJANAF[1],
+         atomizationOffset0K[2][2]-dHf298KExpNISTJANAF[2], atomizationOffset0K[2][3]-dHf298KExpNISTJANAF[3],
+         atomizationOffset0K[2][4]-dHf298KExpNISTJANAF[4], atomizationOffset0K[2][5]-dHf298KExpNISTJANAF[5],
+         atomizationOffset0K[2][6]-dHf298KExpNISTJANAF[6], atomizationOffset0K[2][7]-dHf298KExpNISTJANAF[7],
+         atomizationOffset0K[2][8]-dHf298KExpNISTJANAF[8], atomizationOffset0K[2][9]-dHf298KExpNISTJANAF[9],
+         atomizationOffset0K[2][10]-dHf298KExpNISTJANAF[10], atomizationOffset0K[2][11]-dHf298KExpNISTJANAF[11],
+         atomizationOffset0K[2][12]-dHf298KExpNISTJANAF[12], atomizationOffset0K[2][13]-dHf298KExpNISTJANAF[13],
+         atomizationOffset0K[2][14]-dHf298KExpNISTJANAF[14], atomizationOffset0K[2][15]-dHf298KExpNISTJANAF[15],
+         atomizationOffset0K[2][16]-dHf298KExpNISTJANAF[16], atomizationOffset0K[2][17]-dHf298KExpNISTJANAF[17],
+         atomizationOffset0K[2][18]-dHf298KExpNISTJANAF[18] }
+   };
 /* ************************************************************************** */
 };
 /* ************************************************************************** */
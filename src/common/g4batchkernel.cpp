@@ -0,0 +1,146 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cmath>
+#include "g4batchkernel.h"
+#include "atom.h"
+
+G4BatchKernel::G4BatchKernel() {
+}
+void G4BatchKernel::Clear() {
+   mp2gtbas1.clear(); mp4gtbas1.clear(); ccsdtg3bas1.clear();
+   mp2gtbas2.clear(); mp4gtbas2.clear();
+   mp2gtbas3.clear(); mp4gtbas3.clear();
+   hfgtlargexp.clear(); mp2gtlargexp.clear();
+   hfgfhfb1.clear(); hfgfhfb2.clear();
+   zpe.clear();
+   nValEl.clear();
+   methodA.clear();
+   methodFreqFact.clear();
+}
+void G4BatchKernel::Reserve(const size_t n) {
+   mp2gtbas1.reserve(n); mp4gtbas1.reserve(n); ccsdtg3bas1.reserve(n);
+   mp2gtbas2.reserve(n); mp4gtbas2.reserve(n);
+   mp2gtbas3.reserve(n); mp4gtbas3.reserve(n);
+   hfgtlargexp.reserve(n); mp2gtlargexp.reserve(n);
+   hfgfhfb1.reserve(n); hfgfhfb2.reserve(n);
+   zpe.reserve(n);
+   nValEl.reserve(n);
+   methodA.reserve(n);
+   methodFreqFact.reserve(n);
+}
+void G4BatchKernel::AddMolecule(const RawG4sData &rd) {
+   mp2gtbas1.push_back(rd.mp2gtbas1);
+   mp4gtbas1.push_back(rd.mp4gtbas1);
+   ccsdtg3bas1.push_back(rd.ccsdtg3bas1);
+   mp2gtbas2.push_back(rd.mp2gtbas2);
+   mp4gtbas2.push_back(rd.mp4gtbas2);
+   mp2gtbas3.push_back(rd.mp2gtbas3);
+   mp4gtbas3.push_back(rd.mp4gtbas3);
+   hfgtlargexp.push_back(rd.hfgtlargexp);
+   mp2gtlargexp.push_back(rd.mp2gtlargexp);
+   hfgfhfb1.push_back(rd.hfgfhfb1);
+   hfgfhfb2.push_back(rd.hfgfhfb2);
+   zpe.push_back(rd.zpe);
+   /* Same as CalculateG4::GetValenceElectrons.  */
+   int nval=0;
+   for ( size_t i=0 ; i<rd.compZ.size() ; ++i ) {
+      nval+=(rd.compCount[i])*(Atom::GetValenceElectrons(rd.compZ[i]));
+   }
+   nval/=2;
+   nValEl.push_back(double(nval));
+   const G4MethodParameters &prm=G4Methods::GetParameters(rd.g4method);
+   methodA.push_back(prm.A);
+   methodFreqFact.push_back(prm.scalingFreqFact);
+}
+template<bool PERMOL> void G4BatchKernel::Kernel(const double ealpha,const double* aa,\
+      const double* ff,double* g4e) const {
+   const size_t n=zpe.size();
+   const double* __restrict__ b1=mp2gtbas1.data();
+   const double* __restrict__ b2=mp4gtbas1.data();
+   const double* __restrict__ b3=ccsdtg3bas1.data();
+   const double* __restrict__ b4=mp2gtbas2.data();
+   const double* __restrict__ b5=mp4gtbas2.data();
+   const double* __restrict__ b6=mp2gtbas3.data();
+   const double* __restrict__ b7=mp4gtbas3.data();
+   const double* __restrict__ b8=hfgtlargexp.data();
+   const double* __restrict__ b9=mp2gtlargexp.data();
+   const double* __restrict__ b10=hfgfhfb1.data();
+   const double* __restrict__ b11=hfgfhfb2.data();
+   const double* __restrict__ z=zpe.data();
+   const double* __restrict__ nv=nValEl.data();
+   double* __restrict__ res=g4e;
+   double EComb,EHLC;
+   for ( size_t i=0 ; i<n ; ++i ) {
+      EComb=CombineEnergies(b1[i],b2[i],b3[i],b4[i],b5[i],b6[i],b7[i],b8[i],\
+            b9[i],b10[i],b11[i],ealpha,0.0e0);
+      EHLC=(-nv[i]*(PERMOL ? aa[i] : aa[0]));
+      res[i]=(EComb+EHLC)+z[i]*(PERMOL ? ff[i] : ff[0]);
+   }
+}
+void G4BatchKernel::ComputeG4Energies(const double alpha,vector<double> &g4e) const {
+   g4e.resize(zpe.size());
+   if ( zpe.size()==0 ) { return; }
+   Kernel<true>(exp(-alpha),methodA.data(),methodFreqFact.data(),g4e.data());
+}
+void G4BatchKernel::ComputeG4Energies(const double alpha,const double aa,const double ff,\
+      vector<double> &g4e) const {
+   g4e.resize(zpe.size());
+   if ( zpe.size()==0 ) { return; }
+   Kernel<false>(exp(-alpha),&aa,&ff,g4e.data());
+}
+void G4BatchKernel::ComputeG4EnergiesAndDerivatives(const double alpha,const double aa,\
+      const double ff,vector<double> &g4e,vector<double> &dalpha,vector<double> &da,\
+      vector<double> &dff) const {
+   ComputeG4Energies(alpha,aa,ff,g4e);
+   const size_t n=zpe.size();
+   dalpha.resize(n);
+   da.resize(n);
+   dff.resize(n);
+   const double e=exp(-alpha);
+   const double fa=-e/((1.0e0-e)*(1.0e0-e));
+   for ( size_t i=0 ; i<n ; ++i ) {
+      dalpha[i]=fa*(hfgfhfb2[i]-hfgfhfb1[i]);
+      da[i]=-nValEl[i];
+      dff[i]=zpe[i];
+   }
+}
+
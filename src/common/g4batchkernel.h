@@ -0,0 +1,127 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _G4BATCHKERNEL_H_
+#define _G4BATCHKERNEL_H_
+#include <cstddef>
+#include <vector>
+using std::vector;
+#include "rawg4sdata.h"
+
+/* ************************************************************************** */
+/** This class holds the raw energies of N molecules as a structure of arrays,
+ * and computes their G4(0 K) energies in a single loop, which the compiler
+ * can vectorize (e.g. with -O3 -march=native). The loop uses the same
+ * inline functions as CalculateG4::ComputeG4Energy (CombineEnergies and
+ * HFLimit), with exp(-alpha) hoisted out of the loop, so the results are
+ * bit-for-bit identical to the scalar path. The multireference (T1Diag, LHGap)
+ * and spin-orbit corrections are not included (they are not used by default),
+ * and, as in CalculateG4, only closed shell molecules are meaningful.
+ * This is intended for parameter refits, sweeps, etc., over large sets of
+ * molecules.  */
+class G4BatchKernel {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   G4BatchKernel();
+   void Clear();
+   void Reserve(const size_t n);
+   /** Appends the data of a molecule. The method's default frequency
+    * factor and A are saved for the molecule (see G4Methods).  */
+   void AddMolecule(const RawG4sData &rd);
+   size_t Size() const { return zpe.size(); }
+   /** Computes the G4(0 K) energies (in a.u.) of all the molecules, using
+    * the default frequency factor and A of each molecule's method.  */
+   void ComputeG4Energies(const double alpha,vector<double> &g4e) const;
+   /** Computes the G4(0 K) energies (in a.u.) of all the molecules, using
+    * the same A and frequency factor ff for all of them.  */
+   void ComputeG4Energies(const double alpha,const double aa,const double ff,\
+         vector<double> &g4e) const;
+   /** Same as above, but also computes the derivatives of the G4 energies with
+    * respect to alpha, A, and ff. The energy is linear in A and ff, hence
+    * dA=-(number of valence electron pairs), and dff=ZPE; for alpha,
+    * dE/dalpha=-e(B11-B10)/(1-e)^2, with e=exp(-alpha).  */
+   void ComputeG4EnergiesAndDerivatives(const double alpha,const double aa,const double ff,\
+         vector<double> &g4e,vector<double> &dalpha,vector<double> &da,vector<double> &dff) const;
+/* ************************************************************************** */
+   /** Extrapolated Hartree-Fock limit; see Eq. (1) of [curtiss2007].
+    * ealpha is exp(-alpha).  */
+   static inline double HFLimit(const double B10,const double B11,const double ealpha) {
+      return (B11-B10*ealpha)/(1.0e0-ealpha);
+   }
+   /** Returns the combined energy (EComb) of the G4 recipe, from the
+    * raw energies B1,...,B11 (see CalculateG4::ComputeG4Energy) and
+    * the spin-orbit correction dESO. ealpha is exp(-alpha).  */
+   static inline double CombineEnergies(const double B1,const double B2,const double B3,\
+         const double B4,const double B5,const double B6,const double B7,const double B8,\
+         const double B9,const double B10,const double B11,const double ealpha,\
+         const double dESO) {
+      double E_HFLim=HFLimit(B10,B11,ealpha);
+      double dEplus=B5-B2;
+      double dE2dfp=B7-B2;
+      double dECC=B3-B2;
+      double dEG3LargeXP=B9-B6-B4+B1;
+      double dEHF=E_HFLim-B8;
+      return B2+dEplus+dE2dfp+dECC+dEG3LargeXP+dEHF+dESO;
+   }
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   /** The loop itself. A and ff are arrays if PERMOL is true; otherwise, only
+    * aa[0] and ff[0] are used.  */
+   template<bool PERMOL> void Kernel(const double ealpha,const double* aa,\
+         const double* ff,double* g4e) const;
+   vector<double> mp2gtbas1,mp4gtbas1,ccsdtg3bas1;
+   vector<double> mp2gtbas2,mp4gtbas2;
+   vector<double> mp2gtbas3,mp4gtbas3;
+   vector<double> hfgtlargexp,mp2gtlargexp;
+   vector<double> hfgfhfb1,hfgfhfb2;
+   vector<double> zpe;
+   vector<double> nValEl; /*!< Number of valence electron pairs (see CalculateG4::GetHLCTerm).  */
+   vector<double> methodA;
+   vector<double> methodFreqFact;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _G4BATCHKERNEL_H_ */
+
@@ -0,0 +1,100 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _G4METHODS_H_
+#define _G4METHODS_H_
+#include <string>
+using std::string;
+
+/* ************************************************************************** */
+/** Variants of the G4 method. The first one is the standard G4
+ * (B3LYP/6-31G(2df,p) geometry and frequencies, as in g09), the other ones
+ * use the functional (or MP2) indicated by their names for the
+ * geometry/frequency step (see the script g4-nitro-closed-xxx).  */
+enum class G4Method { STD=0, B3LYP, M062X, MP2, WB97XD, PBE1PBE, PBEPBE, UNKNOWN };
+/* ************************************************************************** */
+/** Parameters that depend on the method.  */
+struct G4MethodParameters {
+   const char* name; /*!< Name, as saved in the report (METHOD keyword).  */
+   double scalingFreqFact; /*!< Frequency scaling factor. Taken from: https://cccbdb.nist.gov/vibscalejust.asp  */
+   double A; /*!< HLC constant; see Eq. (7), and the paragraph that follows it, of [curtiss2007].  */
+   double alpha; /*!< See Eq. (1) of [curtiss2007]  */
+   double B; /*!< HLC constant; see Eq. (7) of [curtiss2007].  */
+   double C; /*!< HLC constant; see Eq. (7) of [curtiss2007].  */
+   double D; /*!< HLC constant; see Eq. (7) of [curtiss2007].  */
+};
+/* ************************************************************************** */
+class G4Methods {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   /** Returns the method whose name is mthd (e.g. "g4-b3lyp"), or
+    * G4Method::UNKNOWN.  */
+   static G4Method GetMethod(const string &mthd);
+   /** Returns the parameters of the method m. For G4Method::UNKNOWN
+    * the scaling factor and A are set to zero.  */
+   static const G4MethodParameters &GetParameters(const G4Method m) {
+      return table[static_cast<int>(m)];
+   }
+   static const char* GetName(const G4Method m) { return GetParameters(m).name; }
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   static constexpr int NMETHODS=static_cast<int>(G4Method::UNKNOWN)+1;
+   /** One row per method, in the same order as the enum G4Method.  */
+   static constexpr G4MethodParameters table[NMETHODS]={
+      /* name           scalingFreqFact  A           alpha    B            C            D  */
+      {"g4-std",        0.9854e0,        6.947e-3,   1.63e0,  0.002441e0,  0.007116e0,  0.001414e0},
+      {"g4-b3lyp",      0.95932e0,       6.7354e-3,  1.63e0,  0.002441e0,  0.007116e0,  0.001414e0},
+      {"g4-m062x",      0.96196e0,       6.8188e-3,  1.63e0,  0.002441e0,  0.007116e0,  0.001414e0},
+      {"g4-mp2",        0.93312e0,       6.7168e-3,  1.63e0,  0.002441e0,  0.007116e0,  0.001414e0},
+      {"g4-wb97xd",     0.95606e0,       6.7867e-3,  1.63e0,  0.002441e0,  0.007116e0,  0.001414e0},
+      {"g4-pbe1pbe",    0.957e0,         6.947e-3,   1.63e0,  0.002441e0,  0.007116e0,  0.001414e0},
+      {"g4-pbepbe",     0.990e0,         6.947e-3,   1.63e0,  0.002441e0,  0.007116e0,  0.001414e0},
+      {"unknown",       0.0e0,           0.0e0,      1.63e0,  0.002441e0,  0.007116e0,  0.001414e0}
+   };
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _G4METHODS_H_ */
+
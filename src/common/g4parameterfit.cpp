@@ -0,0 +1,364 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+#include <iostream>
+using std::cout;
+using std::endl;
+#include <iomanip>
+using std::setprecision;
+#include <sstream>
+#include <fstream>
+using std::ifstream;
+#include "g4parameterfit.h"
+#include "g4atomicproperties.h"
+#include "screenutils.h"
+
+G4ParameterFit::G4ParameterFit() {
+   evibTreatment=G4Variants::HORR;
+   atomicRef=G4Variants::JANAF;
+   for ( int i=0 ; i<NPARAMS ; ++i ) {
+      param[i]=0.0e0;
+      stdErr[i]=0.0e0;
+      fitParam[i]=true;
+   }
+   iterations=0;
+}
+bool G4ParameterFit::SetVariant(const G4Variants::EvibTreatment evt,\
+      const G4Variants::AtomicReference ref) {
+   evibTreatment=evt;
+   atomicRef=ref;
+   if ( names.size()==0 ) { return true; }
+   return ComputeOffsets();
+}
+bool G4ParameterFit::ComputeOffsets() {
+   RawG4sData rd;
+   bool ok=true;
+   offset.resize(names.size());
+   for ( size_t i=0 ; i<names.size() ; ++i ) {
+      rd.compZ=compZ[i];
+      rd.compCount=compCount[i];
+      rd.islinear=isLinear[i];
+      if ( !CalculateG4::ComputeAtomizationOffset(rd,atomicRef,offset[i]) ) {
+         ScreenUtils::DisplayErrorMessage(string("There is no atomic data for some atoms of '")+\
+               names[i]+string("'!"));
+         ok=false;
+      }
+   }
+   return ok;
+}
+bool G4ParameterFit::ReadTrainingSet(const string &fname) {
+   ifstream ifil(fname.c_str());
+   if ( !ifil.good() ) {
+      ScreenUtils::DisplayErrorFileNotOpen(fname);
+      ifil.close();
+      return false;
+   }
+   kernel.Clear();
+   vibk.clear(); freqs.clear(); names.clear(); dhfExp.clear(); offset.clear();
+   compZ.clear(); compCount.clear(); isLinear.clear();
+   string line,repname;
+   double dhf;
+   bool ok=true;
+   G4Method method=G4Method::UNKNOWN;
+   while ( std::getline(ifil,line) ) {
+      std::istringstream iss(line);
+      if ( !(iss >> repname) || repname[0]=='#' ) { continue; }
+      if ( !(iss >> dhf) ) {
+         ScreenUtils::DisplayErrorMessage(string("Missing Delta H_f for '")+repname+string("'!"));
+         ok=false;
+         continue;
+      }
+      RawG4sData rd;
+      if ( !rd.Read(repname) ) {
+         rd.DisplayMessages();
+         ScreenUtils::DisplayErrorMessage(string("The report '")+repname+string("' could not be read!"));
+         ok=false;
+         continue;
+      }
+      if ( (rd.nElAlpha)!=(rd.nElBeta) ) {
+         ScreenUtils::DisplayErrorMessage(string("Only closed shell molecules are accepted ('")+\
+               repname+string("')!"));
+         ok=false;
+         continue;
+      }
+      if ( names.size()==0 ) {
+         method=rd.g4method;
+      } else if ( rd.g4method!=method ) {
+         ScreenUtils::DisplayErrorMessage(string("The method of '")+repname+\
+               string("' differs from the method of the first report!"));
+         ok=false;
+         continue;
+      }
+      double off;
+      if ( !CalculateG4::ComputeAtomizationOffset(rd,atomicRef,off) ) {
+         ScreenUtils::DisplayErrorMessage(string("There is no atomic data for some atoms of '")+\
+               repname+string("'!"));
+         ok=false;
+         continue;
+      }
+      kernel.AddMolecule(rd);
+      freqs.push_back(rd.frequencies);
+      names.push_back(repname);
+      dhfExp.push_back(dhf);
+      offset.push_back(off);
+      compZ.push_back(rd.compZ);
+      compCount.push_back(rd.compCount);
+      isLinear.push_back(rd.islinear);
+   }
+   ifil.close();
+   if ( !ok ) { return false; }
+   if ( names.size()<size_t(NPARAMS) ) {
+      ScreenUtils::DisplayErrorMessage("The training set is too small!");
+      return false;
+   }
+   vibk.resize(names.size());
+   const G4MethodParameters &prm=G4Methods::GetParameters(method);
+   param[ALPHA]=prm.alpha;
+   param[CONSTA]=prm.A;
+   param[FREQFACT]=prm.scalingFreqFact;
+   if ( method==G4Method::UNKNOWN ) {
+      ScreenUtils::DisplayWarningMessage("Unknown method; set the initial values of A"
+            " and of the frequency factor!");
+   }
+   return true;
+}
+void G4ParameterFit::ComputeResiduals(const double* par,vector<double> &res,vector<double>* jac) {
+   const size_t n=names.size();
+   kernel.ComputeG4EnergiesAndDerivatives(par[ALPHA],par[CONSTA],par[FREQFACT],g4e,dalpha,da,dff);
+   res.resize(n);
+   if ( jac!=nullptr ) { jac->resize(n*NPARAMS); }
+   const double h2kJ=G4AtomicProperties::hartree2kJPerMole;
+   const double J2H=G4AtomicProperties::JPMole2Hartree;
+   double evib[G4Variants::NEVIB],devib[G4Variants::NEVIB];
+   for ( size_t i=0 ; i<n ; ++i ) {
+      vibk[i].Setup(freqs[i],par[FREQFACT]);
+      vibk[i].ComputeEvibAndDerivative(2.9815e+02,evib[G4Variants::HORR],evib[G4Variants::NICOLAIDES],\
+            devib[G4Variants::HORR],devib[G4Variants::NICOLAIDES]);
+      res[i]=(g4e[i]+evib[evibTreatment]*J2H+offset[i])*h2kJ-dhfExp[i];
+      if ( jac!=nullptr ) {
+         (*jac)[i*NPARAMS+ALPHA]=dalpha[i]*h2kJ;
+         (*jac)[i*NPARAMS+CONSTA]=da[i]*h2kJ;
+         (*jac)[i*NPARAMS+FREQFACT]=(dff[i]+devib[evibTreatment]*J2H)*h2kJ;
+      }
+   }
+}
+double G4ParameterFit::SumOfSquares(const vector<double> &res) {
+   double s=0.0e0;
+   for ( size_t i=0 ; i<res.size() ; ++i ) { s+=res[i]*res[i]; }
+   return s;
+}
+bool G4ParameterFit::Fit(const int maxit) {
+   /* Levenberg-Marquardt, with the damping scaled by the diagonal of J^T J.  */
+   const size_t n=names.size();
+   int idx[NPARAMS],np=0;
+   for ( int k=0 ; k<NPARAMS ; ++k ) {
+      stdErr[k]=0.0e0;
+      if ( fitParam[k] ) { idx[np++]=k; }
+   }
+   vector<double> jac,trialRes;
+   ComputeResiduals(param,residuals,&jac);
+   double sse=SumOfSquares(residuals);
+   iterations=0;
+   if ( np==0 || n==0 ) { return true; }
+   double lambda=1.0e-03;
+   double JtJ[NPARAMS][NPARAMS],Jtr[NPARAMS],M[NPARAMS][NPARAMS+1];
+   double trial[NPARAMS];
+   bool converged=false;
+   while ( iterations<maxit && !converged ) {
+      ++iterations;
+      for ( int a=0 ; a<np ; ++a ) {
+         Jtr[a]=0.0e0;
+         for ( int b=0 ; b<np ; ++b ) { JtJ[a][b]=0.0e0; }
+      }
+      for ( size_t i=0 ; i<n ; ++i ) {
+         const double* ji=&jac[i*NPARAMS];
+         for ( int a=0 ; a<np ; ++a ) {
+            Jtr[a]+=ji[idx[a]]*residuals[i];
+            for ( int b=0 ; b<np ; ++b ) { JtJ[a][b]+=ji[idx[a]]*ji[idx[b]]; }
+         }
+      }
+      bool accepted=false;
+      while ( !accepted ) {
+         /* Solves (J^T J+lambda diag(J^T J)) delta=-J^T r (Gauss-Jordan with pivoting).  */
+         for ( int a=0 ; a<np ; ++a ) {
+            for ( int b=0 ; b<np ; ++b ) { M[a][b]=JtJ[a][b]; }
+            M[a][a]+=lambda*JtJ[a][a];
+            M[a][np]=-Jtr[a];
+         }
+         bool singular=false;
+         for ( int a=0 ; a<np ; ++a ) {
+            int piv=a;
+            for ( int b=a+1 ; b<np ; ++b ) { if ( fabs(M[b][a])>fabs(M[piv][a]) ) { piv=b; } }
+            if ( M[piv][a]==0.0e0 ) { singular=true; break; }
+            if ( piv!=a ) { for ( int c=0 ; c<=np ; ++c ) { std::swap(M[a][c],M[piv][c]); } }
+            for ( int b=0 ; b<np ; ++b ) {
+               if ( b==a ) { continue; }
+               double f=M[b][a]/M[a][a];
+               for ( int c=a ; c<=np ; ++c ) { M[b][c]-=f*M[a][c]; }
+            }
+         }
+         if ( singular ) {
+            ScreenUtils::DisplayErrorMessage("Singular normal equations (the parameters"
+                  " cannot be determined from this training set)!");
+            return false;
+         }
+         for ( int k=0 ; k<NPARAMS ; ++k ) { trial[k]=param[k]; }
+         double stepNorm=0.0e0,parNorm=0.0e0;
+         for ( int a=0 ; a<np ; ++a ) {
+            double dlt=M[a][np]/M[a][a];
+            trial[idx[a]]+=dlt;
+            stepNorm+=dlt*dlt;
+            parNorm+=param[idx[a]]*param[idx[a]];
+         }
+         ComputeResiduals(trial,trialRes,nullptr);
+         double trialSSE=SumOfSquares(trialRes);
+         if ( trialSSE<=sse ) {
+            converged=( (sse-trialSSE)<=1.0e-14*sse || stepNorm<=1.0e-24*parNorm );
+            for ( int k=0 ; k<NPARAMS ; ++k ) { param[k]=trial[k]; }
+            sse=trialSSE;
+            lambda*=0.1e0;
+            accepted=true;
+         } else {
+            lambda*=10.0e0;
+            if ( lambda>1.0e+12 ) {
+               /* No further decrease is possible: this is the minimum.  */
+               converged=true;
+               break;
+            }
+         }
+      }
+      ComputeResiduals(param,residuals,&jac);
+   }
+   /* Standard errors: sqrt(diag((J^T J)^{-1}) sse/(n-np)). J^T J is scaled
+    * to unit diagonal, D (J^T J) D, before the inversion, so that the pivots
+    * are compared against a tolerance relative to 1, whatever the scales of
+    * the parameters; then (J^T J)^{-1}=D (D (J^T J) D)^{-1} D.  */
+   bool covOK=( n>size_t(np) );
+   if ( covOK ) {
+      for ( int a=0 ; a<np ; ++a ) {
+         for ( int b=0 ; b<np ; ++b ) { M[a][b]=0.0e0; }
+      }
+      for ( size_t i=0 ; i<n ; ++i ) {
+         const double* ji=&jac[i*NPARAMS];
+         for ( int a=0 ; a<np ; ++a ) {
+            for ( int b=0 ; b<np ; ++b ) { M[a][b]+=ji[idx[a]]*ji[idx[b]]; }
+         }
+      }
+      double inv[NPARAMS][2*NPARAMS],dsc[NPARAMS];
+      bool singular=false;
+      for ( int a=0 ; a<np ; ++a ) {
+         if ( !(M[a][a]>0.0e0) ) { singular=true; break; }
+         dsc[a]=1.0e0/sqrt(M[a][a]);
+      }
+      for ( int a=0 ; a<np && !singular ; ++a ) {
+         for ( int b=0 ; b<np ; ++b ) {
+            inv[a][b]=dsc[a]*M[a][b]*dsc[b];
+            inv[a][np+b]=(a==b ? 1.0e0 : 0.0e0);
+         }
+      }
+      const double pivtol=1.0e-12;
+      for ( int a=0 ; a<np && !singular ; ++a ) {
+         int piv=a;
+         for ( int b=a+1 ; b<np ; ++b ) { if ( fabs(inv[b][a])>fabs(inv[piv][a]) ) { piv=b; } }
+         if ( fabs(inv[piv][a])<=pivtol ) { singular=true; break; }
+         if ( piv!=a ) { for ( int c=0 ; c<2*np ; ++c ) { std::swap(inv[a][c],inv[piv][c]); } }
+         double d=inv[a][a];
+         for ( int c=0 ; c<2*np ; ++c ) { inv[a][c]/=d; }
+         for ( int b=0 ; b<np ; ++b ) {
+            if ( b==a ) { continue; }
+            double f=inv[b][a];
+            for ( int c=0 ; c<2*np ; ++c ) { inv[b][c]-=f*inv[a][c]; }
+         }
+      }
+      if ( !singular ) {
+         double s2=sse/double(n-size_t(np));
+         for ( int a=0 ; a<np ; ++a ) { stdErr[idx[a]]=dsc[a]*sqrt(inv[a][np+a]*s2); }
+      }
+      covOK=!singular;
+   }
+   if ( !covOK ) {
+      for ( int a=0 ; a<np ; ++a ) { stdErr[idx[a]]=std::numeric_limits<double>::quiet_NaN(); }
+      ScreenUtils::DisplayWarningMessage("The covariance matrix could not be formed;"
+            " the standard errors are not available!");
+   }
+   if ( !converged ) {
+      ScreenUtils::DisplayWarningMessage("The fit did not converge!");
+   }
+   return converged;
+}
+double G4ParameterFit::RMSD() const {
+   if ( residuals.size()==0 ) { return 0.0e0; }
+   return sqrt(SumOfSquares(residuals)/double(residuals.size()));
+}
+double G4ParameterFit::MaxAbsDeviation() const {
+   double res=0.0e0;
+   for ( size_t i=0 ; i<residuals.size() ; ++i ) {
+      if ( fabs(residuals[i])>res ) { res=fabs(residuals[i]); }
+   }
+   return res;
+}
+void G4ParameterFit::PrintResults(ostream &ofil) const {
+   std::streamsize oldprec=ofil.precision();
+   ofil << setprecision(10);
+   const char* lbl[NPARAMS]={"alpha","A","freqFact"};
+   for ( int k=0 ; k<NPARAMS ; ++k ) {
+      ofil << "#" << lbl[k] << "= " << param[k];
+      if ( fitParam[k] ) {
+         ofil << " (+/- " << setprecision(3) << stdErr[k] << setprecision(10) << ")\n";
+      } else {
+         ofil << " (fixed)\n";
+      }
+   }
+   ofil << setprecision(5);
+   ofil << "#Molecules: " << names.size() << ", iterations: " << iterations << '\n';
+   ofil << "#RMSD: " << RMSD() << " kJ mol-1, max. abs. deviation: "
+        << MaxAbsDeviation() << " kJ mol-1\n";
+   ofil << "#Report dHf(calc) dHf(exp) dHf(calc)-dHf(exp)\n";
+   for ( size_t i=0 ; i<names.size() ; ++i ) {
+      ofil << names[i] << ' ' << (residuals[i]+dhfExp[i]) << ' ' << dhfExp[i]
+           << ' ' << residuals[i] << '\n';
+   }
+   ofil.precision(oldprec);
+}
+
@@ -0,0 +1,141 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _G4PARAMETERFIT_H_
+#define _G4PARAMETERFIT_H_
+#include <cstddef>
+#include <ostream>
+using std::ostream;
+#include <string>
+using std::string;
+#include <vector>
+using std::vector;
+#include "calculateg4.h"
+#include "g4batchkernel.h"
+#include "g4vibkernel.h"
+
+/* ************************************************************************** */
+/** This class refits the method-specific constants A, alpha, and the
+ * frequency scaling factor, so that the Delta H_f(298.15 K) (atomization
+ * reactions) of a training set of molecules reproduces their experimental
+ * values, in the least-squares sense. The minimization is done with the
+ * Levenberg-Marquardt algorithm, using analytical derivatives: the G4 energy
+ * is linear in A and in the ZPE scale (see G4BatchKernel), the derivative with
+ * respect to alpha has a closed form, and the derivative of Evib with respect
+ * to the scaling factor is computed by G4VibKernel.
+ * The training set is a plain text file, with one molecule per line:
+ *    report.dat  DeltaHf_exp
+ * (DeltaHf_exp in kJ mol-1; lines starting with # are ignored). All the
+ * reports must use the same method. By default, the HO-RR vibrational
+ * energy and the JANAF atomic data are used. The multireference corrections
+ * (T1Diag, LHGap) are not included.  */
+class G4ParameterFit {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   enum Param { ALPHA=0, CONSTA=1, FREQFACT=2, NPARAMS=3 };
+   G4ParameterFit();
+   /** Reads the training set (see the description of the class). Returns
+    * false if a report could not be read, or if there are not enough
+    * molecules.  */
+   bool ReadTrainingSet(const string &fname);
+   /** Selects the variant used for the Delta H_f. If the training set has
+    * already been read, the atomic terms are recomputed for the new
+    * reference; returns false if some molecule has no atomic data for it.  */
+   bool SetVariant(const G4Variants::EvibTreatment evt,const G4Variants::AtomicReference ref);
+   /** Sets whether or not the parameter p is refitted (all of them are
+    * refitted by default).  */
+   void FitParameter(const Param p,const bool fit) { fitParam[p]=fit; }
+   /** Sets the initial value of the parameter p (default: the values of the
+    * method of the training set; see G4Methods).  */
+   void SetInitialValue(const Param p,const double val) { param[p]=val; }
+   /** Runs the fit. Returns false if it did not converge.  */
+   bool Fit(const int maxit=200);
+   double Parameter(const Param p) const { return param[p]; }
+   /** Standard error of the parameter p (zero if p was not refitted, and NaN
+    * if the covariance matrix could not be formed).  */
+   double StandardError(const Param p) const { return stdErr[p]; }
+   size_t NumberOfMolecules() const { return names.size(); }
+   /** Root mean square and maximum absolute deviations, in kJ mol-1.  */
+   double RMSD() const;
+   double MaxAbsDeviation() const;
+   int NumberOfIterations() const { return iterations; }
+   /** Writes the parameters, the statistics, and the calculated and
+    * experimental Delta H_f of every molecule.  */
+   void PrintResults(ostream &ofil) const;
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   /** Computes the residuals (calculated-experimental, in kJ mol-1) and, if
+    * jac is not null, the Jacobian (n x NPARAMS, row-major) at par.  */
+   void ComputeResiduals(const double* par,vector<double> &res,vector<double>* jac);
+   static double SumOfSquares(const vector<double> &res);
+   /** Computes offset (for atomicRef) from the saved compositions. Returns
+    * false if some molecule has no atomic data.  */
+   bool ComputeOffsets();
+   G4BatchKernel kernel;
+   vector<G4VibKernel> vibk;
+   vector<vector<double> > freqs;
+   vector<string> names;
+   vector<double> dhfExp;
+   /** Terms of Delta H_f that do not depend on the parameters (atomic data,
+    * Erot, Etrans, and PV), in hartrees.  */
+   vector<double> offset;
+   /** Compositions of the molecules (see RawG4sData), needed to recompute
+    * offset if the atomic reference changes.  */
+   vector<vector<int> > compZ,compCount;
+   vector<bool> isLinear;
+   vector<double> residuals;
+   G4Variants::EvibTreatment evibTreatment;
+   G4Variants::AtomicReference atomicRef;
+   double param[NPARAMS];
+   double stdErr[NPARAMS];
+   bool fitParam[NPARAMS];
+   int iterations;
+   /* Scratch for ComputeResiduals.  */
+   vector<double> g4e,dalpha,da,dff;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _G4PARAMETERFIT_H_ */
+
@@ -0,0 +1,291 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+using std::cout;
+using std::endl;
+#include <iomanip>
+using std::setprecision;
+#include "g4parametersweep.h"
+#include "g4atomicproperties.h"
+#include "g4vibkernel.h"
+#include "myparser.h"
+#include "screenutils.h"
+
+G4ParameterSweep::G4ParameterSweep() {
+   method=G4Method::UNKNOWN;
+   evibTreatment=G4Variants::HORR;
+   atomicRef=G4Variants::JANAF;
+   for ( int i=0 ; i<NPARAMS ; ++i ) {
+      pMin[i]=pMax[i]=0.0e0;
+      pNum[i]=1;
+      usrRange[i]=false;
+   }
+   T1d=LHGap=0.0e0;
+   useT1Diag=useLHGap=false;
+   coefficientsOK=false;
+}
+bool G4ParameterSweep::SetVariant(const G4Variants::EvibTreatment evt,\
+      const G4Variants::AtomicReference ref) {
+   evibTreatment=evt;
+   atomicRef=ref;
+   coefficientsOK=false;
+   if ( names.size()==0 ) { return true; }
+   return ComputeOffsets();
+}
+bool G4ParameterSweep::ComputeOffsets() {
+   RawG4sData rd;
+   bool ok=true;
+   offset.resize(names.size());
+   for ( size_t i=0 ; i<names.size() ; ++i ) {
+      rd.compZ=compZ[i];
+      rd.compCount=compCount[i];
+      rd.islinear=isLinear[i];
+      if ( !CalculateG4::ComputeAtomizationOffset(rd,atomicRef,offset[i]) ) {
+         ScreenUtils::DisplayErrorMessage(string("There is no atomic data for some atoms of '")+\
+               names[i]+string("'!"));
+         ok=false;
+      }
+   }
+   return ok;
+}
+void G4ParameterSweep::SetRange(const Param p,const double pmin,const double pmax,const size_t n) {
+   pMin[p]=pmin;
+   pMax[p]=pmax;
+   pNum[p]=(n>0 ? n : 1);
+   usrRange[p]=true;
+   coefficientsOK=false;
+}
+bool G4ParameterSweep::ReadReports(const vector<string> &repnames) {
+   kernel.Clear();
+   freqs.clear(); zpe.clear(); nTotEl.clear(); names.clear(); offset.clear();
+   compZ.clear(); compCount.clear(); isLinear.clear();
+   coefficientsOK=false;
+   bool ok=true;
+   for ( size_t k=0 ; k<repnames.size() ; ++k ) {
+      const string &repname=repnames[k];
+      RawG4sData rd;
+      if ( !rd.Read(repname) ) {
+         rd.DisplayMessages();
+         ScreenUtils::DisplayErrorMessage(string("The report '")+repname+string("' could not be read!"));
+         ok=false;
+         continue;
+      }
+      if ( names.size()==0 ) {
+         method=rd.g4method;
+      } else if ( rd.g4method!=method ) {
+         ScreenUtils::DisplayErrorMessage(string("The method of '")+repname+\
+               string("' differs from the method of the first report!"));
+         ok=false;
+         continue;
+      }
+      double off;
+      if ( !CalculateG4::ComputeAtomizationOffset(rd,atomicRef,off) ) {
+         ScreenUtils::DisplayErrorMessage(string("There is no atomic data for some atoms of '")+\
+               repname+string("'!"));
+         ok=false;
+         continue;
+      }
+      int ntot=0;
+      for ( size_t i=0 ; i<rd.compZ.size() ; ++i ) { ntot+=(rd.compCount[i])*(rd.compZ[i]); }
+      kernel.AddMolecule(rd);
+      freqs.push_back(rd.frequencies);
+      zpe.push_back(rd.zpe);
+      nTotEl.push_back(double(ntot));
+      names.push_back(repname);
+      offset.push_back(off);
+      compZ.push_back(rd.compZ);
+      compCount.push_back(rd.compCount);
+      isLinear.push_back(rd.islinear);
+   }
+   if ( !ok ) { return false; }
+   if ( names.size()==0 ) {
+      ScreenUtils::DisplayErrorMessage("No reports to sweep!");
+      return false;
+   }
+   if ( method==G4Method::UNKNOWN && !(usrRange[CONSTA] && usrRange[FREQFACT]) ) {
+      ScreenUtils::DisplayWarningMessage("Unknown method; set the ranges (or values) of A"
+            " and of the frequency factor!");
+   }
+   return true;
+}
+bool G4ParameterSweep::ReadSpecification(const string &fname) {
+   MyParser::Index idx;
+   if ( !idx.Open(fname) ) {
+      ScreenUtils::DisplayErrorFileNotOpen(fname);
+      return false;
+   }
+   const char* keys[NPARAMS]={"SWEEP_ALPHA","SWEEP_FREQ_FACT","SWEEP_A","SWEEP_M","SWEEP_G"};
+   double v[3];
+   bool ok=true;
+   for ( int p=0 ; p<NPARAMS ; ++p ) {
+      if ( idx.Count(keys[p])==0 ) { continue; }
+      if ( !idx.Read(keys[p],v,3) || v[2]<1.0e0 ) {
+         ScreenUtils::DisplayErrorMessage(string("Expected 'min max n' after ")+\
+               string(keys[p])+string(" (in '")+fname+string("')!"));
+         ok=false;
+         continue;
+      }
+      SetRange(Param(p),v[0],v[1],size_t(v[2]));
+   }
+   return ok;
+}
+size_t G4ParameterSweep::NumberOfPoints() {
+   if ( !coefficientsOK ) { ComputeCoefficients(); }
+   size_t res=1;
+   for ( int p=0 ; p<NPARAMS ; ++p ) { res*=values[p].size(); }
+   return res;
+}
+const vector<double> &G4ParameterSweep::Values(const Param p) {
+   if ( !coefficientsOK ) { ComputeCoefficients(); }
+   return values[p];
+}
+void G4ParameterSweep::ComputeCoefficients() {
+   const G4MethodParameters &prm=G4Methods::GetParameters(method);
+   double fixed[NPARAMS];
+   fixed[ALPHA]=prm.alpha;
+   fixed[FREQFACT]=prm.scalingFreqFact;
+   fixed[CONSTA]=prm.A;
+   fixed[CONSTM]=0.0e0;
+   fixed[CONSTG]=0.0e0;
+   for ( int p=0 ; p<NPARAMS ; ++p ) {
+      if ( usrRange[p] ) {
+         values[p].resize(pNum[p]);
+         double h=(pNum[p]>1 ? (pMax[p]-pMin[p])/double(pNum[p]-1) : 0.0e0);
+         for ( size_t k=0 ; k<pNum[p] ; ++k ) { values[p][k]=pMin[p]+double(k)*h; }
+         if ( pNum[p]>1 ) { values[p][pNum[p]-1]=pMax[p]; }
+      } else {
+         values[p].assign(1,fixed[p]);
+      }
+   }
+   const size_t nm=names.size();
+   const double h2kJ=G4AtomicProperties::hartree2kJPerMole;
+   const double J2H=G4AtomicProperties::JPMole2Hartree;
+   /* f(alpha): the kernel with A=0 and freqFact=0 gives only the combination
+    * of the raw energies; its derivatives give -nValEl and the ZPE.  */
+   vector<double> g4e,dalpha,da,dff;
+   const size_t na=values[ALPHA].size();
+   fAlpha.resize(na*nm);
+   for ( size_t k=0 ; k<na ; ++k ) {
+      kernel.ComputeG4EnergiesAndDerivatives(values[ALPHA][k],0.0e0,0.0e0,g4e,dalpha,da,dff);
+      for ( size_t j=0 ; j<nm ; ++j ) { fAlpha[k*nm+j]=g4e[j]*h2kJ; }
+   }
+   cA.resize(nm); cM.resize(nm); cG.resize(nm); c0.resize(nm);
+   for ( size_t j=0 ; j<nm ; ++j ) {
+      cA[j]=da[j]*h2kJ;
+      cM[j]=(useT1Diag ? (-T1d*sqrt(nTotEl[j])*nTotEl[j])*h2kJ : 0.0e0);
+      cG[j]=(useLHGap ? h2kJ/LHGap : 0.0e0);
+      c0[j]=offset[j]*h2kJ;
+   }
+   /* g(freqFact): scaled ZPE plus Evib; one set of exponentials per value.  */
+   const size_t nf=values[FREQFACT].size();
+   gFreq.resize(nf*nm);
+   G4VibKernel vibk;
+   double evib[G4Variants::NEVIB];
+   for ( size_t k=0 ; k<nf ; ++k ) {
+      for ( size_t j=0 ; j<nm ; ++j ) {
+         vibk.Setup(freqs[j],values[FREQFACT][k]);
+         vibk.ComputeEvib(2.9815e+02,evib[G4Variants::HORR],evib[G4Variants::NICOLAIDES]);
+         gFreq[k*nm+j]=(zpe[j]*values[FREQFACT][k]+evib[evibTreatment]*J2H)*h2kJ;
+      }
+   }
+   coefficientsOK=true;
+}
+template<typename F> void G4ParameterSweep::ForEachPoint(F fnc) {
+   if ( !coefficientsOK ) { ComputeCoefficients(); }
+   const size_t nm=names.size();
+   vector<double> s1(nm),s2(nm),s3(nm),s4(nm),row(nm);
+   size_t idx[NPARAMS];
+   const vector<double> &va=values[ALPHA],&vf=values[FREQFACT];
+   const vector<double> &vA=values[CONSTA],&vM=values[CONSTM],&vG=values[CONSTG];
+   for ( idx[ALPHA]=0 ; idx[ALPHA]<va.size() ; ++idx[ALPHA] ) {
+      const double* fa=&fAlpha[idx[ALPHA]*nm];
+      for ( size_t j=0 ; j<nm ; ++j ) { s1[j]=c0[j]+fa[j]; }
+      for ( idx[FREQFACT]=0 ; idx[FREQFACT]<vf.size() ; ++idx[FREQFACT] ) {
+         const double* gf=&gFreq[idx[FREQFACT]*nm];
+         for ( size_t j=0 ; j<nm ; ++j ) { s2[j]=s1[j]+gf[j]; }
+         for ( idx[CONSTA]=0 ; idx[CONSTA]<vA.size() ; ++idx[CONSTA] ) {
+            const double aa=vA[idx[CONSTA]];
+            for ( size_t j=0 ; j<nm ; ++j ) { s3[j]=s2[j]+cA[j]*aa; }
+            for ( idx[CONSTM]=0 ; idx[CONSTM]<vM.size() ; ++idx[CONSTM] ) {
+               const double mm=vM[idx[CONSTM]];
+               for ( size_t j=0 ; j<nm ; ++j ) { s4[j]=s3[j]+cM[j]*mm; }
+               for ( idx[CONSTG]=0 ; idx[CONSTG]<vG.size() ; ++idx[CONSTG] ) {
+                  const double gg=vG[idx[CONSTG]];
+                  for ( size_t j=0 ; j<nm ; ++j ) { row[j]=s4[j]+cG[j]*gg; }
+                  fnc(idx,row);
+               }
+            }
+         }
+      }
+   }
+}
+void G4ParameterSweep::Compute(vector<double> &res) {
+   const size_t nm=names.size();
+   res.resize(NumberOfPoints()*nm);
+   size_t pos=0;
+   ForEachPoint([&res,&pos,nm](const size_t* idx,const vector<double> &row) {
+         for ( size_t j=0 ; j<nm ; ++j ) { res[pos++]=row[j]; }
+      });
+}
+void G4ParameterSweep::PrintTable(ostream &ofil) {
+   if ( !coefficientsOK ) { ComputeCoefficients(); }
+   std::streamsize oldprec=ofil.precision();
+   ofil << "#alpha freqFact A M G";
+   for ( size_t j=0 ; j<names.size() ; ++j ) { ofil << ' ' << names[j]; }
+   ofil << "\n#(Enthalpies of formation, at 298.15 K, in kJ mol-1; points: "
+        << NumberOfPoints() << ")\n";
+   const vector<double>* vals=values;
+   ForEachPoint([&ofil,vals](const size_t* idx,const vector<double> &row) {
+         ofil << setprecision(10);
+         for ( int p=0 ; p<NPARAMS ; ++p ) {
+            if ( p>0 ) { ofil << ' '; }
+            ofil << vals[p][idx[p]];
+         }
+         ofil << setprecision(5);
+         for ( size_t j=0 ; j<row.size() ; ++j ) { ofil << ' ' << row[j]; }
+         ofil << '\n';
+      });
+   ofil.precision(oldprec);
+}
+
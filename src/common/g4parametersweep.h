@@ -0,0 +1,153 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _G4PARAMETERSWEEP_H_
+#define _G4PARAMETERSWEEP_H_
+#include <cstddef>
+#include <ostream>
+using std::ostream;
+#include <string>
+using std::string;
+#include <vector>
+using std::vector;
+#include "calculateg4.h"
+#include "g4batchkernel.h"
+
+/* ************************************************************************** */
+/** This class evaluates the Delta H_f(298.15 K) (atomization reactions) of a
+ * set of molecules over a regular grid of the parameters alpha, frequency
+ * factor, A, M, and G. The Delta H_f is separable in these parameters:
+ *    dHf = c0 + f(alpha) + g(freqFact) + cA*A + cM*M + cG*G,
+ * where f is the combination of the raw energies (closed form in alpha,
+ * see G4BatchKernel), g is the scaled ZPE plus Evib (see G4VibKernel), and
+ * cA, cM, cG are the HLC and multireference coefficients of the molecule.
+ * Hence, f and g are computed once per grid value (not per grid point), and
+ * every point costs a single addition per term and molecule.
+ * cM and cG are zero unless T1Diag and LHGap are set (see SetT1Diag and
+ * SetLHGap), as in CalculateG4. The ranges can be read from a file
+ * (see ReadSpecification); parameters without a range are kept fixed at the
+ * values of the method of the reports (zero for M and G). All the reports
+ * must use the same method. By default, the HO-RR vibrational energy and
+ * the JANAF atomic data are used. The results agree with the ones of
+ * CalculateG4 up to rounding errors.  */
+class G4ParameterSweep {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   /** The points are ordered with alpha as the slowest index, and G as the
+    * fastest one.  */
+   enum Param { ALPHA=0, FREQFACT=1, CONSTA=2, CONSTM=3, CONSTG=4, NPARAMS=5 };
+   G4ParameterSweep();
+   /** Reads the reports. Returns false if a report could not be read, has
+    * no atomic data, or uses a method different from the first one.  */
+   bool ReadReports(const vector<string> &repnames);
+   /** Reads the ranges from the file fname, which contains the keywords
+    * SWEEP_ALPHA, SWEEP_FREQ_FACT, SWEEP_A, SWEEP_M, and/or SWEEP_G, each one
+    * followed by a line with "min max n" (n evenly spaced values from min
+    * to max). Missing keywords keep their parameters fixed.  */
+   bool ReadSpecification(const string &fname);
+   /** Sets n evenly spaced values, from pmin to pmax, for the parameter p.  */
+   void SetRange(const Param p,const double pmin,const double pmax,const size_t n);
+   /** Keeps the parameter p fixed at val.  */
+   void SetValue(const Param p,const double val) { SetRange(p,val,val,1); }
+   void SetT1Diag(const double t1) { useT1Diag=true; T1d=t1; }
+   void SetLHGap(const double gap) { useLHGap=true; LHGap=gap; }
+   /** Selects the variant used for the Delta H_f. If the reports have
+    * already been read, the atomic terms are recomputed for the new
+    * reference; returns false if some molecule has no atomic data for it.  */
+   bool SetVariant(const G4Variants::EvibTreatment evt,const G4Variants::AtomicReference ref);
+   size_t NumberOfMolecules() const { return names.size(); }
+   /** Total number of grid points (call after ReadReports).  */
+   size_t NumberOfPoints();
+   /** Values of the parameter p (call after ReadReports).  */
+   const vector<double> &Values(const Param p);
+   /** Computes the Delta H_f (kJ mol-1) of all the molecules at all the grid
+    * points; res[i*NumberOfMolecules()+j] holds the value of the j-th
+    * molecule at the i-th point.  */
+   void Compute(vector<double> &res);
+   /** Writes one row per grid point: the five parameters, followed by the
+    * Delta H_f of every molecule. The rows are computed on the fly, so the
+    * grid is never stored.  */
+   void PrintTable(ostream &ofil);
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   /** Sets the values of the fixed parameters, and computes the terms of
+    * every molecule (see the description of the class).  */
+   void ComputeCoefficients();
+   /** Calls fnc(idx,row) for every grid point, in order. idx holds the
+    * indices of the point, and row the Delta H_f of every molecule.  */
+   template<typename F> void ForEachPoint(F fnc);
+   /** Computes offset (for atomicRef) from the saved compositions. Returns
+    * false if some molecule has no atomic data.  */
+   bool ComputeOffsets();
+   G4BatchKernel kernel;
+   vector<vector<double> > freqs;
+   vector<double> zpe; /*!< Unscaled ZPE, in hartrees.  */
+   vector<double> nTotEl; /*!< Total number of electrons (see CalculateG4::GetT1DiagTerm).  */
+   vector<string> names;
+   /** Terms that do not depend on the parameters (atomic data, Erot, Etrans,
+    * and PV), in hartrees.  */
+   vector<double> offset;
+   /** Compositions of the molecules (see RawG4sData), needed to recompute
+    * offset if the atomic reference changes.  */
+   vector<vector<int> > compZ,compCount;
+   vector<bool> isLinear;
+   G4Method method;
+   G4Variants::EvibTreatment evibTreatment;
+   G4Variants::AtomicReference atomicRef;
+   double pMin[NPARAMS],pMax[NPARAMS];
+   size_t pNum[NPARAMS];
+   bool usrRange[NPARAMS];
+   vector<double> values[NPARAMS];
+   double T1d,LHGap;
+   bool useT1Diag,useLHGap;
+   bool coefficientsOK;
+   /* Per-molecule terms (see ComputeCoefficients), in kJ mol-1. fAlpha and
+    * gFreq are stored as (grid value)x(molecule), row-major.  */
+   vector<double> fAlpha,gFreq,cA,cM,cG,c0;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _G4PARAMETERSWEEP_H_ */
+
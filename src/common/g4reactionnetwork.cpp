@@ -0,0 +1,551 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <iostream>
+using std::cout;
+using std::endl;
+#include <iomanip>
+using std::setprecision;
+#include <sstream>
+#include <fstream>
+using std::ifstream;
+#include "g4reactionnetwork.h"
+#include "g4atomicproperties.h"
+#include "screenutils.h"
+#include "workstealingpool.h"
+
+G4ReactionNetwork::G4ReactionNetwork() {
+   rowPtr.assign(1,0);
+   autoGenerate=false;
+   iterations=0;
+   evibTreatment=G4Variants::HORR;
+   scalingFreqFact=A=alpha=0.0e0;
+   usrScaleFact=usrConstantA=usrAlpha=false;
+}
+size_t G4ReactionNetwork::FindSpecies(const string &name) const {
+   std::unordered_map<string,size_t>::const_iterator it=index.find(name);
+   if ( it==index.end() ) { return names.size(); }
+   return it->second;
+}
+size_t G4ReactionNetwork::AddSpecies(const string &name,const string &repname,\
+      const bool isref,const double dhfexp) {
+   size_t s=names.size();
+   names.push_back(name);
+   repNames.push_back(repname);
+   isRef.push_back(isref);
+   computedOK.push_back(false);
+   dhfExp.push_back(isref ? dhfexp : std::numeric_limits<double>::quiet_NaN());
+   enthalpy.push_back(std::numeric_limits<double>::quiet_NaN());
+   compZ.push_back(vector<int>());
+   compCount.push_back(vector<int>());
+   errorMessages.push_back(vector<string>());
+   index[name]=s;
+   return s;
+}
+void G4ReactionNetwork::AddReaction(const vector<size_t> &spc,const vector<double> &coef) {
+   /* Repeated species are merged, so that every row has unique columns.  */
+   size_t start=colIdx.size();
+   for ( size_t k=0 ; k<spc.size() ; ++k ) {
+      size_t j=start;
+      while ( j<colIdx.size() && colIdx[j]!=spc[k] ) { ++j; }
+      if ( j<colIdx.size() ) {
+         coefs[j]+=coef[k];
+      } else {
+         colIdx.push_back(spc[k]);
+         coefs.push_back(coef[k]);
+      }
+   }
+   rowPtr.push_back(colIdx.size());
+}
+bool G4ReactionNetwork::ParseReaction(const string &str,vector<size_t> &spc,vector<double> &coef) const {
+   std::istringstream iss(str);
+   string tok;
+   double sign=-1.0e0,c=1.0e0;
+   bool havecoef=false;
+   spc.clear();
+   coef.clear();
+   while ( iss >> tok ) {
+      if ( tok==string("+") ) { continue; }
+      if ( tok==string("=") ) {
+         if ( sign>0.0e0 ) { return false; }
+         sign=1.0e0;
+         continue;
+      }
+      char* endp;
+      double v=std::strtod(tok.c_str(),&endp);
+      if ( (*endp)=='\0' && !havecoef ) {
+         c=v;
+         havecoef=true;
+         continue;
+      }
+      size_t s=FindSpecies(tok);
+      if ( s==names.size() ) {
+         ScreenUtils::DisplayErrorMessage(string("Unknown species '")+tok+string("'!"));
+         return false;
+      }
+      spc.push_back(s);
+      coef.push_back(sign*c);
+      c=1.0e0;
+      havecoef=false;
+   }
+   return (sign>0.0e0 && spc.size()>1 && !havecoef);
+}
+bool G4ReactionNetwork::ReadNetwork(const string &fname) {
+   ifstream ifil(fname.c_str());
+   if ( !ifil.good() ) {
+      ScreenUtils::DisplayErrorFileNotOpen(fname);
+      ifil.close();
+      return false;
+   }
+   string line,key,name,repname,rest;
+   vector<string> reactions;
+   double val;
+   bool ok=true;
+   while ( std::getline(ifil,line) ) {
+      std::istringstream iss(line);
+      if ( !(iss >> key) || key[0]=='#' ) { continue; }
+      if ( key==string("SPECIES") ) {
+         if ( !(iss >> name >> repname) ) {
+            ScreenUtils::DisplayErrorMessage(string("Incomplete line: '")+line+string("'!"));
+            ok=false;
+            continue;
+         }
+         if ( FindSpecies(name)!=names.size() ) {
+            ScreenUtils::DisplayErrorMessage(string("Repeated species '")+name+string("'!"));
+            ok=false;
+            continue;
+         }
+         bool isref=static_cast<bool>(iss >> val);
+         AddSpecies(name,repname,isref,(isref ? val : 0.0e0));
+      } else if ( key==string("REACTION") ) {
+         std::getline(iss,rest);
+         reactions.push_back(rest);
+      } else if ( key==string("AUTO") ) {
+         autoGenerate=true;
+      } else {
+         ScreenUtils::DisplayErrorMessage(string("Unknown keyword '")+key+string("'!"));
+         ok=false;
+      }
+   }
+   ifil.close();
+   /* The reactions are parsed after all the species are known.  */
+   vector<size_t> spc;
+   vector<double> coef;
+   for ( size_t r=0 ; r<reactions.size() ; ++r ) {
+      if ( !ParseReaction(reactions[r],spc,coef) ) {
+         ScreenUtils::DisplayErrorMessage(string("Wrong reaction: '")+reactions[r]+string("'!"));
+         ok=false;
+         continue;
+      }
+      AddReaction(spc,coef);
+   }
+   return ok;
+}
+void G4ReactionNetwork::ComputeOneSpecies(const size_t s) {
+   RawG4sData data;
+   bool readok=data.Read(repNames[s]);
+   errorMessages[s]=data.ErrorMessages();
+   if ( !readok ) { return; }
+   CalculateG4 cg(data,0);
+   if ( usrScaleFact ) { cg.SetScalingFreqencyFactor(scalingFreqFact); }
+   if ( usrConstantA ) { cg.SetConstantA(A); }
+   if ( usrAlpha ) { cg.SetAlpha(alpha); }
+   G4Variants var=cg.ComputeAllVariants();
+   errorMessages[s].insert(errorMessages[s].end(),\
+         cg.ErrorMessages().begin(),cg.ErrorMessages().end());
+   if ( !cg.ComputeOK() ) { return; }
+   enthalpy[s]=var.g4Enthalpy0K[evibTreatment];
+   compZ[s]=data.compZ;
+   compCount[s]=data.compCount;
+   computedOK[s]=true;
+}
+bool G4ReactionNetwork::ComputeSpecies(const size_t nthr) {
+   WorkStealingPool pool(nthr);
+   pool.ParallelFor(names.size(),[this](size_t s){ ComputeOneSpecies(s); });
+   if ( autoGenerate ) { GenerateReactions(); }
+   return NumberOfFailures()==0;
+}
+size_t G4ReactionNetwork::NumberOfFailures() const {
+   size_t res=0;
+   for ( size_t s=0 ; s<names.size() ; ++s ) { if ( !computedOK[s] ) { ++res; } }
+   return res;
+}
+bool G4ReactionNetwork::SolveSmallSystem(vector<double> &a,vector<double> &b,const size_t n) {
+   /* Gauss-Jordan elimination with partial pivoting.  */
+   for ( size_t k=0 ; k<n ; ++k ) {
+      size_t p=k;
+      for ( size_t i=k+1 ; i<n ; ++i ) { if ( fabs(a[i*n+k])>fabs(a[p*n+k]) ) { p=i; } }
+      if ( fabs(a[p*n+k])<1.0e-12 ) { return false; }
+      if ( p!=k ) {
+         for ( size_t j=0 ; j<n ; ++j ) { std::swap(a[k*n+j],a[p*n+j]); }
+         std::swap(b[k],b[p]);
+      }
+      double piv=a[k*n+k];
+      for ( size_t j=0 ; j<n ; ++j ) { a[k*n+j]/=piv; }
+      b[k]/=piv;
+      for ( size_t i=0 ; i<n ; ++i ) {
+         if ( i==k || a[i*n+k]==0.0e0 ) { continue; }
+         double f=a[i*n+k];
+         for ( size_t j=0 ; j<n ; ++j ) { a[i*n+j]-=f*a[k*n+j]; }
+         b[i]-=f*b[k];
+      }
+   }
+   return true;
+}
+size_t G4ReactionNetwork::GenerateReactions() {
+   /* For every element (other than H), the reference with the fewest atoms
+    * that contains only that element and hydrogen (hydrides are preferred);
+    * and the smallest reference made only of hydrogen.  */
+   const int maxz=18; // First three rows (see CalculateG4::CheckAtomicData).
+   vector<size_t> best(maxz+1,names.size());
+   vector<int> bestScore(maxz+1,0);
+   for ( size_t s=0 ; s<names.size() ; ++s ) {
+      if ( !(isRef[s] && computedOK[s]) ) { continue; }
+      int heavy=0,score=0;
+      size_t nheavy=0;
+      for ( size_t i=0 ; i<compZ[s].size() ; ++i ) {
+         score+=compCount[s][i];
+         if ( compZ[s][i]!=1 ) { heavy=compZ[s][i]; ++nheavy; }
+      }
+      if ( nheavy>1 || heavy>maxz ) { continue; }
+      if ( nheavy==0 ) { heavy=1; }
+      if ( compZ[s].size()==1 && heavy!=1 ) { score+=1000; }
+      if ( best[heavy]==names.size() || score<bestScore[heavy] ) {
+         best[heavy]=s;
+         bestScore[heavy]=score;
+      }
+   }
+   size_t res=0;
+   vector<size_t> refs,spc;
+   vector<double> a,b,coef;
+   for ( size_t s=0 ; s<names.size() ; ++s ) {
+      if ( isRef[s] || !computedOK[s] ) { continue; }
+      /* One reference per element of the molecule; H2 is used if H is
+       * present in the molecule or in the other references. Without an H2
+       * reference, the square system is solved for the other elements, and
+       * hydrogen must balance by itself (checked below).  */
+      vector<int> elem=compZ[s];
+      bool needH=false,ok=true;
+      refs.clear();
+      for ( size_t i=0 ; i<elem.size() ; ++i ) {
+         if ( elem[i]==1 ) { needH=true; continue; }
+         if ( elem[i]>maxz || best[elem[i]]==names.size() ) { ok=false; break; }
+         refs.push_back(best[elem[i]]);
+         if ( compZ[best[elem[i]]].size()>1 ) { needH=true; }
+      }
+      const bool checkH=( needH && best[1]==names.size() );
+      if ( checkH ) {
+         elem.erase(std::remove(elem.begin(),elem.end(),1),elem.end());
+      } else if ( needH ) {
+         refs.push_back(best[1]);
+         if ( std::find(elem.begin(),elem.end(),1)==elem.end() ) { elem.push_back(1); }
+      }
+      if ( !ok || refs.size()!=elem.size() || refs.size()==0 ) {
+         errorMessages[s].push_back("No reaction could be generated (missing reference species).");
+         continue;
+      }
+      const size_t n=elem.size();
+      a.assign(n*n,0.0e0);
+      b.assign(n,0.0e0);
+      for ( size_t e=0 ; e<n ; ++e ) {
+         for ( size_t i=0 ; i<compZ[s].size() ; ++i ) {
+            if ( compZ[s][i]==elem[e] ) { b[e]=double(compCount[s][i]); }
+         }
+         for ( size_t k=0 ; k<n ; ++k ) {
+            const size_t r=refs[k];
+            for ( size_t i=0 ; i<compZ[r].size() ; ++i ) {
+               if ( compZ[r][i]==elem[e] ) { a[e*n+k]=double(compCount[r][i]); }
+            }
+         }
+      }
+      if ( !SolveSmallSystem(a,b,n) ) {
+         errorMessages[s].push_back("No reaction could be generated (singular scheme).");
+         continue;
+      }
+      if ( checkH ) {
+         double hbal=0.0e0;
+         for ( size_t i=0 ; i<compZ[s].size() ; ++i ) {
+            if ( compZ[s][i]==1 ) { hbal=double(compCount[s][i]); }
+         }
+         for ( size_t k=0 ; k<n ; ++k ) {
+            const size_t r=refs[k];
+            for ( size_t i=0 ; i<compZ[r].size() ; ++i ) {
+               if ( compZ[r][i]==1 ) { hbal-=b[k]*double(compCount[r][i]); }
+            }
+         }
+         if ( fabs(hbal)>1.0e-10 ) {
+            errorMessages[s].push_back("No reaction could be generated (hydrogen cannot be"
+                  " balanced without an H2 reference).");
+            continue;
+         }
+      }
+      spc.assign(1,s);
+      coef.assign(1,-1.0e0);
+      for ( size_t k=0 ; k<n ; ++k ) {
+         if ( fabs(b[k])<1.0e-12 ) { continue; }
+         spc.push_back(refs[k]);
+         coef.push_back(b[k]);
+      }
+      AddReaction(spc,coef);
+      ++res;
+   }
+   return res;
+}
+bool G4ReactionNetwork::Solve(const double tol,const size_t maxit) {
+   const size_t ns=names.size();
+   const size_t nr=NumberOfReactions();
+   const double h2kJ=G4AtomicProperties::hartree2kJPerMole;
+   const double nan=std::numeric_limits<double>::quiet_NaN();
+   /* Columns of the unknowns (non-reference species).  */
+   vector<size_t> col(ns,ns);
+   size_t nu=0;
+   for ( size_t s=0 ; s<ns ; ++s ) { if ( !isRef[s] ) { col[s]=nu++; } }
+   /* The matrix of the unknowns (CSR), and the right hand side (kJ mol-1).
+    * Reactions with a species that failed are skipped.  */
+   vector<size_t> ptr(1,0),cidx;
+   vector<double> val,rhs;
+   vector<size_t> rowOfReaction(nr,nr);
+   nReactions.assign(ns,0);
+   for ( size_t r=0 ; r<nr ; ++r ) {
+      bool ok=true;
+      for ( size_t k=rowPtr[r] ; k<rowPtr[r+1] ; ++k ) { if ( !computedOK[colIdx[k]] ) { ok=false; } }
+      if ( !ok ) { continue; }
+      double dh=0.0e0,known=0.0e0;
+      for ( size_t k=rowPtr[r] ; k<rowPtr[r+1] ; ++k ) {
+         const size_t s=colIdx[k];
+         dh+=coefs[k]*enthalpy[s];
+         if ( coefs[k]==0.0e0 ) { continue; }
+         ++nReactions[s];
+         if ( isRef[s] ) {
+            known+=coefs[k]*dhfExp[s];
+         } else {
+            cidx.push_back(col[s]);
+            val.push_back(coefs[k]);
+         }
+      }
+      rowOfReaction[r]=rhs.size();
+      rhs.push_back(dh*h2kJ-known);
+      ptr.push_back(cidx.size());
+   }
+   const size_t m=rhs.size();
+   /* CGLS: CG on A^T A x = A^T b, with x0=0.  */
+   vector<double> x(nu,0.0e0),rr(rhs),ss(nu,0.0e0),pp(nu),qq(m);
+   for ( size_t i=0 ; i<m ; ++i ) {
+      for ( size_t k=ptr[i] ; k<ptr[i+1] ; ++k ) { ss[cidx[k]]+=val[k]*rr[i]; }
+   }
+   pp=ss;
+   double gamma=0.0e0;
+   for ( size_t j=0 ; j<nu ; ++j ) { gamma+=ss[j]*ss[j]; }
+   const double gamma0=gamma;
+   const size_t nit=(maxit>0 ? maxit : std::max(size_t(100),2*nu));
+   bool converged=(gamma0==0.0e0);
+   iterations=0;
+   for ( size_t it=0 ; it<nit && !converged ; ++it ) {
+      double qq2=0.0e0;
+      for ( size_t i=0 ; i<m ; ++i ) {
+         double q=0.0e0;
+         for ( size_t k=ptr[i] ; k<ptr[i+1] ; ++k ) { q+=val[k]*pp[cidx[k]]; }
+         qq[i]=q;
+         qq2+=q*q;
+      }
+      if ( qq2==0.0e0 ) { break; }
+      double alph=gamma/qq2;
+      for ( size_t j=0 ; j<nu ; ++j ) { x[j]+=alph*pp[j]; }
+      for ( size_t i=0 ; i<m ; ++i ) { rr[i]-=alph*qq[i]; }
+      std::fill(ss.begin(),ss.end(),0.0e0);
+      for ( size_t i=0 ; i<m ; ++i ) {
+         for ( size_t k=ptr[i] ; k<ptr[i+1] ; ++k ) { ss[cidx[k]]+=val[k]*rr[i]; }
+      }
+      double gnew=0.0e0;
+      for ( size_t j=0 ; j<nu ; ++j ) { gnew+=ss[j]*ss[j]; }
+      ++iterations;
+      if ( sqrt(gnew)<=tol*sqrt(gamma0) ) { converged=true; }
+      double beta=gnew/gamma;
+      for ( size_t j=0 ; j<nu ; ++j ) { pp[j]=ss[j]+beta*pp[j]; }
+      gamma=gnew;
+   }
+   vector<bool> undet;
+   FindUndeterminedUnknowns(ptr,cidx,val,nu,undet);
+   dhf.assign(ns,nan);
+   determined.assign(ns,false);
+   for ( size_t s=0 ; s<ns ; ++s ) {
+      if ( isRef[s] ) {
+         dhf[s]=dhfExp[s];
+         determined[s]=true;
+      } else if ( nReactions[s]>0 ) {
+         if ( undet[col[s]] ) {
+            ScreenUtils::DisplayWarningMessage(names[s]+string(": the Delta H_f is not"
+                     " determined by the reactions (rank-deficient network); nan is reported."));
+            continue;
+         }
+         dhf[s]=x[col[s]];
+         determined[s]=true;
+      }
+   }
+   /* Residuals (calculated minus fitted reaction enthalpy).  */
+   residuals.assign(nr,nan);
+   for ( size_t r=0 ; r<nr ; ++r ) {
+      if ( rowOfReaction[r]==nr ) { continue; }
+      residuals[r]=rr[rowOfReaction[r]];
+   }
+   if ( !converged ) {
+      ScreenUtils::DisplayWarningMessage("CG did not converge!");
+   }
+   return converged;
+}
+void G4ReactionNetwork::FindUndeterminedUnknowns(const vector<size_t> &ptr,\
+      const vector<size_t> &cidx,const vector<double> &val,const size_t nu,vector<bool> &undet) {
+   /* The reactions couple the unknowns into independent blocks (connected
+    * components), and the null space is the sum of the null spaces of the
+    * blocks. Hence, every block is reduced on its own (dense Gauss-Jordan
+    * with partial pivoting); blocks are small in practice (one unknown per
+    * block for AUTO).  */
+   const size_t m=ptr.size()-1;
+   vector<size_t> parent(nu);
+   for ( size_t j=0 ; j<nu ; ++j ) { parent[j]=j; }
+   auto root=[&parent](size_t j) {
+      while ( parent[j]!=j ) { parent[j]=parent[parent[j]]; j=parent[j]; }
+      return j;
+   };
+   for ( size_t i=0 ; i<m ; ++i ) {
+      for ( size_t k=ptr[i]+1 ; k<ptr[i+1] ; ++k ) {
+         size_t ra=root(cidx[ptr[i]]),rb=root(cidx[k]);
+         if ( ra!=rb ) { parent[rb]=ra; }
+      }
+   }
+   vector<size_t> blk(nu,nu),loc(nu);
+   vector<vector<size_t> > bcols,brows;
+   for ( size_t j=0 ; j<nu ; ++j ) {
+      size_t r=root(j);
+      if ( blk[r]==nu ) {
+         blk[r]=bcols.size();
+         bcols.push_back(vector<size_t>());
+         brows.push_back(vector<size_t>());
+      }
+      loc[j]=bcols[blk[r]].size();
+      bcols[blk[r]].push_back(j);
+   }
+   for ( size_t i=0 ; i<m ; ++i ) {
+      if ( ptr[i+1]>ptr[i] ) { brows[blk[root(cidx[ptr[i]])]].push_back(i); }
+   }
+   undet.assign(nu,false);
+   vector<double> a;
+   vector<size_t> pivCol;
+   vector<bool> isPiv;
+   for ( size_t b=0 ; b<bcols.size() ; ++b ) {
+      const size_t nc=bcols[b].size(),mr=brows[b].size();
+      a.assign(mr*nc,0.0e0);
+      double amax=0.0e0;
+      for ( size_t q=0 ; q<mr ; ++q ) {
+         const size_t i=brows[b][q];
+         for ( size_t k=ptr[i] ; k<ptr[i+1] ; ++k ) {
+            a[q*nc+loc[cidx[k]]]+=val[k];
+            amax=std::max(amax,fabs(val[k]));
+         }
+      }
+      const double tol=1.0e-10*amax;
+      pivCol.clear();
+      isPiv.assign(nc,false);
+      size_t r=0;
+      for ( size_t c=0 ; c<nc && r<mr ; ++c ) {
+         size_t p=r;
+         for ( size_t q=r+1 ; q<mr ; ++q ) { if ( fabs(a[q*nc+c])>fabs(a[p*nc+c]) ) { p=q; } }
+         if ( !(fabs(a[p*nc+c])>tol) ) { continue; }
+         if ( p!=r ) { for ( size_t j=0 ; j<nc ; ++j ) { std::swap(a[r*nc+j],a[p*nc+j]); } }
+         double piv=a[r*nc+c];
+         for ( size_t j=0 ; j<nc ; ++j ) { a[r*nc+j]/=piv; }
+         for ( size_t q=0 ; q<mr ; ++q ) {
+            if ( q==r || a[q*nc+c]==0.0e0 ) { continue; }
+            double f=a[q*nc+c];
+            for ( size_t j=0 ; j<nc ; ++j ) { a[q*nc+j]-=f*a[r*nc+j]; }
+         }
+         pivCol.push_back(c);
+         isPiv[c]=true;
+         ++r;
+      }
+      /* Free columns are undetermined; so are the pivot columns coupled
+       * to a free column (the null vectors are e_f-sum_q a[q][f] e_pivCol[q]).  */
+      for ( size_t c=0 ; c<nc ; ++c ) {
+         if ( isPiv[c] ) { continue; }
+         undet[bcols[b][c]]=true;
+         for ( size_t q=0 ; q<r ; ++q ) {
+            if ( fabs(a[q*nc+c])>1.0e-10 ) { undet[bcols[b][pivCol[q]]]=true; }
+         }
+      }
+   }
+}
+double G4ReactionNetwork::RMSResidual() const {
+   double s=0.0e0;
+   size_t n=0;
+   for ( size_t r=0 ; r<residuals.size() ; ++r ) {
+      if ( residuals[r]!=residuals[r] ) { continue; }
+      s+=residuals[r]*residuals[r];
+      ++n;
+   }
+   return (n>0 ? sqrt(s/double(n)) : 0.0e0);
+}
+void G4ReactionNetwork::PrintResults(ostream &ofil) const {
+   std::streamsize oldprec=ofil.precision();
+   ofil << setprecision(5);
+   ofil << "#Species: " << names.size() << ", reactions: " << NumberOfReactions()
+        << ", CG iterations: " << iterations << '\n';
+   ofil << "#RMS reaction residual: " << RMSResidual() << " kJ mol-1\n";
+   ofil << "#Species dHf(298.15 K) nReactions reference\n";
+   ofil << "#(Enthalpies of formation in kJ mol-1)\n";
+   for ( size_t s=0 ; s<names.size() ; ++s ) {
+      ofil << names[s] << ' ' << dhf[s] << ' '
+           << (s<nReactions.size() ? nReactions[s] : 0)
+           << ' ' << (isRef[s] ? "yes" : "no") << '\n';
+   }
+   ofil.precision(oldprec);
+}
+void G4ReactionNetwork::DisplayMessages() const {
+   for ( size_t s=0 ; s<names.size() ; ++s ) {
+      for ( size_t j=0 ; j<errorMessages[s].size() ; ++j ) {
+         ScreenUtils::DisplayErrorMessage(names[s]+string(": ")+errorMessages[s][j]);
+      }
+   }
+}
+
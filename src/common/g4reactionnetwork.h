@@ -0,0 +1,180 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _G4REACTIONNETWORK_H_
+#define _G4REACTIONNETWORK_H_
+#include <cstddef>
+#include <ostream>
+using std::ostream;
+#include <string>
+using std::string;
+#include <vector>
+using std::vector;
+#include <unordered_map>
+#include "calculateg4.h"
+
+/* ************************************************************************** */
+/** This class computes the Delta H_f(298.15 K) of a set of species from a
+ * network of reactions (e.g. isodesmic or homodesmotic) that involve them and
+ * some reference species, whose experimental Delta H_f(298.15 K) is known.
+ * For every reaction r, sum_s nu_rs H_s (H_s is the G4 enthalpy of the
+ * species s, computed once per species and shared by all its reactions)
+ * is the reaction enthalpy, which must equal sum_s nu_rs Delta H_f(s).
+ * The Delta H_f of the species that are not references are the unknowns of
+ * this (sparse, usually overdetermined) linear system, which is solved for
+ * the whole network at once, in the least-squares sense, with the conjugate
+ * gradient method applied to the normal equations (CGLS); the matrix is
+ * stored in CSR format, and the normal equations are never formed. Species
+ * that do not appear in any reaction get nan. If the system is rank
+ * deficient, the species whose Delta H_f is not determined by the reactions
+ * (e.g. X = Y, with neither X nor Y a reference) also get nan, and Solve
+ * displays a warning for each one of them (see IsDetermined).
+ * The network is read from a plain text file (see ReadNetwork). The G4
+ * enthalpies do not depend on the atomic reference data; by default, the
+ * HO-RR vibrational energy is used.  */
+class G4ReactionNetwork {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   G4ReactionNetwork();
+   /** Reads the network from fname. Every line is one of the following
+    * (lines starting with # are ignored):
+    *    SPECIES name report.dat [DeltaHf_exp]
+    *    REACTION [c1] name1 + [c2] name2 + ... = [c3] name3 + ...
+    *    AUTO
+    * A species with DeltaHf_exp (kJ mol-1) is a reference. The coefficients
+    * of a reaction are optional (default: 1). AUTO generates one reaction per
+    * non-reference species (see GenerateReactions), after the species
+    * have been computed.  */
+   bool ReadNetwork(const string &fname);
+   /** Adds a species; dhfexp is used only if isref is true. Returns its index.  */
+   size_t AddSpecies(const string &name,const string &repname,const bool isref,const double dhfexp);
+   /** Adds the reaction sum_k coef[k] spc[k] (products have positive
+    * coefficients).  */
+   void AddReaction(const vector<size_t> &spc,const vector<double> &coef);
+   /** Selects the vibrational treatment used for the enthalpies.  */
+   void SetVariant(const G4Variants::EvibTreatment evt) { evibTreatment=evt; }
+   /** The following setters override the constants of the methods of the
+    * reports (see CalculateG4).  */
+   void SetScalingFreqencyFactor(const double ff) { usrScaleFact=true; scalingFreqFact=ff; }
+   void SetConstantA(const double aa) { usrConstantA=true; A=aa; }
+   void SetAlpha(const double aa) { usrAlpha=true; alpha=aa; }
+   /** Computes the G4 enthalpy of every species, using nthr threads
+    * (nthr=0 means all the available hardware threads). Returns false if
+    * some species failed.  */
+   bool ComputeSpecies(const size_t nthr=0);
+   /** For every species that is not a reference and has a composition
+    * (i.e. after ComputeSpecies), generates the element-balanced reaction
+    *    M -> sum_k c_k R_k,
+    * where R_k are the smallest references made of one element (other than
+    * H) and hydrogen (e.g. CH4, NH3, H2O; if there is no such hydride, e.g.
+    * N2 or O2), plus the smallest reference made only of hydrogen (H2). The reports do not contain the connectivity, so
+    * this is the only scheme that can be generated automatically; proper
+    * isodesmic or homodesmotic schemes must be given as reactions.
+    * H2 is optional: without it, a reaction is generated only if hydrogen
+    * is balanced by the other references (e.g. with CH4 as the only
+    * reference, C2H6 -> 2 CH4 is not balanced, but CH4 -> CH4 is).
+    * Returns the number of reactions generated.  */
+   size_t GenerateReactions();
+   /** Solves the network. Returns false if CG did not converge.  */
+   bool Solve(const double tol=1.0e-12,const size_t maxit=0);
+   size_t NumberOfSpecies() const { return names.size(); }
+   size_t NumberOfReactions() const { return rowPtr.size()-1; }
+   size_t NumberOfFailures() const;
+   /** Delta H_f(298.15 K) of the species s, in kJ mol-1 (the experimental
+    * value for the references).  */
+   double DeltaHf298K(const size_t s) const { return dhf[s]; }
+   /** Returns false if the Delta H_f of the species s could not be
+    * determined (no reactions, or a rank-deficient network; see Solve).  */
+   bool IsDetermined(const size_t s) const { return (s<determined.size() && determined[s]); }
+   /** Root mean square of the reaction residuals, in kJ mol-1.  */
+   double RMSResidual() const;
+   int NumberOfIterations() const { return iterations; }
+   /** Writes one row per species: name, Delta H_f(298.15 K), number of
+    * reactions, and whether it is a reference.  */
+   void PrintResults(ostream &ofil) const;
+   /** Displays (in order) the errors found for every species.  */
+   void DisplayMessages() const;
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   /** Returns the index of the species name, or NumberOfSpecies() if it does
+    * not exist.  */
+   size_t FindSpecies(const string &name) const;
+   /** Parses the terms of a REACTION line. Returns false on error.  */
+   bool ParseReaction(const string &str,vector<size_t> &spc,vector<double> &coef) const;
+   void ComputeOneSpecies(const size_t s);
+   /** Solves the square system a x = b (n x n, row-major) in place.
+    * Returns false if the matrix is singular.  */
+   static bool SolveSmallSystem(vector<double> &a,vector<double> &b,const size_t n);
+   /** Sets undet[j] to true if the unknown j is not determined by the
+    * system whose matrix (m x nu, CSR) is given by ptr, cidx, and val, i.e.,
+    * if some vector of the null space has a nonzero j-th component.  */
+   static void FindUndeterminedUnknowns(const vector<size_t> &ptr,const vector<size_t> &cidx,\
+         const vector<double> &val,const size_t nu,vector<bool> &undet);
+   /* Species.  */
+   vector<string> names,repNames;
+   vector<bool> isRef,computedOK;
+   vector<double> dhfExp; /*!< In kJ mol-1.  */
+   vector<double> enthalpy; /*!< G4 enthalpy at 298.15 K, in hartrees.  */
+   vector<vector<int> > compZ,compCount;
+   vector<vector<string> > errorMessages;
+   std::unordered_map<string,size_t> index;
+   /* Reactions, in CSR format (one row per reaction, one column per species).  */
+   vector<size_t> rowPtr;
+   vector<size_t> colIdx;
+   vector<double> coefs;
+   vector<double> residuals; /*!< In kJ mol-1.  */
+   vector<double> dhf;
+   vector<size_t> nReactions; /*!< Reactions (solved) in which the species appears.  */
+   vector<bool> determined;
+   bool autoGenerate;
+   int iterations;
+   G4Variants::EvibTreatment evibTreatment;
+   double scalingFreqFact,A,alpha;
+   bool usrScaleFact,usrConstantA,usrAlpha;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _G4REACTIONNETWORK_H_ */
+
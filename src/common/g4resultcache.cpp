@@ -0,0 +1,269 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "g4resultcache.h"
+#include "g4methods.h"
+#include "g4atomicproperties.h"
+#include "screenutils.h"
+
+static const char g4ResultCacheMagic[8]={'G','4','R','C','A','C','H','E'};
+
+G4ResultCache::G4ResultCache() {
+   hdr=nullptr;
+   entries=nullptr;
+   mapSize=0;
+}
+G4ResultCache::~G4ResultCache() {
+   Close();
+}
+bool G4ResultCache::Open(const string &fname,size_t mincap) {
+   Close();
+   size_t cap=1024;
+   while ( cap<mincap ) { cap*=2; }
+   fileName=fname;
+   struct stat st;
+   if ( stat(fname.c_str(),&st)==0 ) {
+      if ( Map(fname,0,false) ) { return true; }
+      ScreenUtils::DisplayWarningMessage(string("The cache '")+fname+\
+            string("' is not compatible; a new one will be created."));
+   }
+   if ( !Map(fname,cap,true) ) {
+      ScreenUtils::DisplayErrorMessage(string("The cache '")+fname+string("' could not be created!"));
+      return false;
+   }
+   return true;
+}
+void G4ResultCache::Close() {
+   std::lock_guard<std::mutex> lck(mtx);
+   Unmap();
+}
+void G4ResultCache::Unmap() {
+   if ( hdr!=nullptr ) {
+      msync(static_cast<void*>(hdr),mapSize,MS_SYNC);
+      munmap(static_cast<void*>(hdr),mapSize);
+   }
+   hdr=nullptr;
+   entries=nullptr;
+   mapSize=0;
+}
+bool G4ResultCache::Map(const string &fname,size_t cap,bool create) {
+   int fd=open(fname.c_str(),(create ? (O_RDWR|O_CREAT|O_TRUNC) : O_RDWR),0644);
+   if ( fd<0 ) { return false; }
+   size_t sz;
+   if ( create ) {
+      sz=sizeof(G4ResultCacheHeader)+cap*sizeof(G4ResultCacheEntry);
+      if ( ftruncate(fd,off_t(sz))!=0 ) { close(fd); return false; }
+   } else {
+      struct stat st;
+      if ( fstat(fd,&st)!=0 || size_t(st.st_size)<sizeof(G4ResultCacheHeader) ) {
+         close(fd);
+         return false;
+      }
+      sz=size_t(st.st_size);
+   }
+   void* ptr=mmap(nullptr,sz,PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+   close(fd);
+   if ( ptr==MAP_FAILED ) { return false; }
+   G4ResultCacheHeader* h=static_cast<G4ResultCacheHeader*>(ptr);
+   if ( create ) {
+      /* ftruncate zero-fills the file, i.e. all the slots are empty.  */
+      std::memcpy(h->magic,g4ResultCacheMagic,8);
+      h->version=CACHEVERSION;
+      h->capacity=cap;
+      h->count=0;
+      h->tables=TablesHash();
+   } else {
+      cap=size_t(h->capacity);
+      bool ok=(std::memcmp(h->magic,g4ResultCacheMagic,8)==0) && (h->version==CACHEVERSION);
+      ok=ok && (cap>0) && ((cap&(cap-1))==0);
+      ok=ok && (sz==sizeof(G4ResultCacheHeader)+cap*sizeof(G4ResultCacheEntry));
+      ok=ok && (h->tables==TablesHash());
+      if ( !ok ) {
+         munmap(ptr,sz);
+         return false;
+      }
+   }
+   hdr=h;
+   entries=reinterpret_cast<G4ResultCacheEntry*>(static_cast<char*>(ptr)+sizeof(G4ResultCacheHeader));
+   mapSize=sz;
+   return true;
+}
+size_t G4ResultCache::Size() const {
+   std::lock_guard<std::mutex> lck(mtx);
+   return ( hdr==nullptr ? 0 : size_t(hdr->count) );
+}
+uint64_t G4ResultCache::HashBytes(const void* data,size_t len,uint64_t seed) {
+   /* Multiply-rotate over 8-byte words, with the splitmix64 finalizer.  */
+   const uint64_t k1=0x9E3779B97F4A7C15ULL;
+   const uint64_t k2=0xC2B2AE3D27D4EB4FULL;
+   const unsigned char* p=static_cast<const unsigned char*>(data);
+   uint64_t h=seed^(uint64_t(len)*k1);
+   uint64_t w;
+   while ( len>=8 ) {
+      std::memcpy(&w,p,8);
+      w*=k2;
+      w=(w<<31)|(w>>33);
+      h^=w*k1;
+      h=((h<<27)|(h>>37))*5ULL+0x52DCE729ULL;
+      p+=8;
+      len-=8;
+   }
+   w=0;
+   for ( size_t i=0 ; i<len ; ++i ) { w|=(uint64_t(p[i])<<(8*i)); }
+   w*=k2;
+   w=(w<<31)|(w>>33);
+   h^=w*k1;
+   h^=(h>>30); h*=0xBF58476D1CE4E5B9ULL;
+   h^=(h>>27); h*=0x94D049BB133111EBULL;
+   h^=(h>>31);
+   return h;
+}
+uint64_t G4ResultCache::TablesHash() {
+   /* The default parameters of the methods (numbers only; the names are
+    * pointers), and every atomic datum used by CalculateG4.  */
+   uint64_t res=CACHEVERSION;
+   double mp[6];
+   for ( int i=0 ; i<=static_cast<int>(G4Method::UNKNOWN) ; ++i ) {
+      const G4MethodParameters &m=G4Methods::GetParameters(static_cast<G4Method>(i));
+      mp[0]=m.scalingFreqFact; mp[1]=m.A; mp[2]=m.alpha;
+      mp[3]=m.B; mp[4]=m.C; mp[5]=m.D;
+      res=HashBytes(mp,sizeof(mp),res);
+   }
+   typedef G4AtomicProperties AP;
+   double ap[8+2*AP::NSOURCES];
+   for ( int z=0 ; z<AP::NZ ; ++z ) {
+      ap[0]=AP::GetG4StdEnergy0K(z);
+      ap[1]=AP::GetG4StdEnthalpy0K(z);
+      ap[2]=AP::GetG4StdH298mH0(z);
+      ap[3]=AP::GetDeltaHf298KNISTJANAF(z);
+      ap[4]=AP::GetDeltaHf0KJANAF(z);
+      ap[5]=AP::GetDeltaHf0KTajti(z);
+      ap[6]=AP::GetDeltaHf0KATcT(z);
+      ap[7]=double(AP::DataMask(z));
+      for ( int s=0 ; s<AP::NSOURCES ; ++s ) {
+         ap[8+2*s]=AP::GetAtomizationOffset0K(AP::DeltaHfSource(s),z);
+         ap[9+2*s]=AP::GetAtomizationOffset298K(AP::DeltaHfSource(s),z);
+      }
+      res=HashBytes(ap,sizeof(ap),res);
+   }
+   return res;
+}
+G4ResultCache::Key G4ResultCache::ComputeKey(const char* rep,size_t len,\
+      const double* prm,size_t nprm) {
+   /* Seeds: the parameters and the version (the tables are checked in the
+    * header of the file).  */
+   uint64_t seed=HashBytes(prm,nprm*sizeof(double),CACHEVERSION);
+   Key res;
+   res.h[0]=HashBytes(rep,len,seed);
+   res.h[1]=HashBytes(rep,len,seed^0x6A09E667F3BCC908ULL);
+   if ( res.h[0]==0 && res.h[1]==0 ) { res.h[0]=1; } //{0,0} marks an empty slot
+   return res;
+}
+size_t G4ResultCache::FindSlot(const Key &key) const {
+   const size_t mask=size_t(hdr->capacity)-1;
+   size_t i=size_t(key.h[0])&mask;
+   for ( size_t n=0 ; n<=mask ; ++n ) {
+      const G4ResultCacheEntry &e=entries[i];
+      if ( (e.key[0]==key.h[0] && e.key[1]==key.h[1]) || (e.key[0]==0 && e.key[1]==0) ) {
+         return i;
+      }
+      i=(i+1)&mask;
+   }
+   return mask+1;
+}
+bool G4ResultCache::Lookup(const Key &key,G4Variants &var) const {
+   std::lock_guard<std::mutex> lck(mtx);
+   if ( hdr==nullptr ) { return false; }
+   size_t i=FindSlot(key);
+   if ( i==size_t(hdr->capacity) ) { return false; }
+   const G4ResultCacheEntry &e=entries[i];
+   if ( e.key[0]==0 && e.key[1]==0 ) { return false; }
+   var=e.var;
+   return true;
+}
+bool G4ResultCache::Insert(const Key &key,const G4Variants &var) {
+   std::lock_guard<std::mutex> lck(mtx);
+   if ( hdr==nullptr ) { return false; }
+   if ( 10*(hdr->count+1)>7*hdr->capacity ) {
+      if ( !Grow() ) { return false; }
+   }
+   size_t i=FindSlot(key);
+   if ( i==size_t(hdr->capacity) ) { return false; }
+   G4ResultCacheEntry &e=entries[i];
+   if ( e.key[0]==0 && e.key[1]==0 ) { ++(hdr->count); }
+   e.var=var;
+   e.key[0]=key.h[0];
+   e.key[1]=key.h[1];
+   return true;
+}
+bool G4ResultCache::Grow() {
+   /* The new table is built in a temporary file, which then replaces the
+    * old one. No messages here: this runs in the worker threads, so the
+    * caller reports the failure.  */
+   string tmpName=fileName+string(".tmp");
+   G4ResultCacheHeader* oldHdr=hdr;
+   G4ResultCacheEntry* oldEntries=entries;
+   size_t oldSize=mapSize;
+   size_t oldCap=size_t(hdr->capacity);
+   hdr=nullptr;
+   if ( !Map(tmpName,2*oldCap,true) ) {
+      hdr=oldHdr;
+      return false;
+   }
+   Key k;
+   for ( size_t i=0 ; i<oldCap ; ++i ) {
+      const G4ResultCacheEntry &e=oldEntries[i];
+      if ( e.key[0]==0 && e.key[1]==0 ) { continue; }
+      k.h[0]=e.key[0];
+      k.h[1]=e.key[1];
+      entries[FindSlot(k)]=e;
+      ++(hdr->count);
+   }
+   munmap(static_cast<void*>(oldHdr),oldSize);
+   return ( std::rename(tmpName.c_str(),fileName.c_str())==0 );
+}
+
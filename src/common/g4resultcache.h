@@ -0,0 +1,140 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _G4RESULTCACHE_H_
+#define _G4RESULTCACHE_H_
+#include <cstddef>
+#include <cstdint>
+#include <string>
+using std::string;
+#include <mutex>
+#include "calculateg4.h"
+
+/* ************************************************************************** */
+/** Header of the cache file.  */
+struct G4ResultCacheHeader {
+   char magic[8];
+   uint64_t version;
+   uint64_t capacity; /*!< Number of slots (a power of two).  */
+   uint64_t count; /*!< Number of used slots.  */
+   uint64_t tables; /*!< Hash of the atomic and method tables (see TablesHash).  */
+};
+/** One slot of the cache file. An empty slot has key={0,0}.  */
+struct G4ResultCacheEntry {
+   uint64_t key[2];
+   G4Variants var;
+};
+/* ************************************************************************** */
+/** On-disk, content-addressed cache of G4 results. The key of a result is
+ * a 128-bit hash of the bytes of the report and of the parameters that
+ * determine the effective CalculateG4 parameters, i.e. the user-defined
+ * values (frequency factor, A, alpha, M, T1d, G, and LHGap, together with
+ * the flags telling whether they were set). Since the method is read from
+ * the report, this fully determines the effective parameters, and the
+ * key can be computed without reading the report.
+ * The header of the file holds a hash of the atomic data (see
+ * G4AtomicProperties) and of the default parameters of the methods (see
+ * G4Methods); a file written with different tables is discarded.
+ * The cache file is a memory-mapped open-addressing hash table (linear
+ * probing); a lookup is a single probe sequence in the mapped file. The
+ * table is doubled (and rewritten) when it becomes 70% full.
+ * Lookup and Insert are thread-safe, and do not display messages, but a
+ * cache file must not be used by several processes at the same time.
+ * Change CACHEVERSION whenever the computed quantities or the layout of the
+ * file change, so that old files are discarded.  */
+class G4ResultCache {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   struct Key {
+      uint64_t h[2];
+   };
+   G4ResultCache();
+   ~G4ResultCache();
+   G4ResultCache(const G4ResultCache &)=delete;
+   G4ResultCache &operator=(const G4ResultCache &)=delete;
+   /** Opens (or creates, with room for at least mincap entries) the
+    * cache file fname. An incompatible (or damaged) file is replaced by an
+    * empty cache. Returns false if the file cannot be created or mapped.  */
+   bool Open(const string &fname,size_t mincap=65536);
+   /** Flushes and unmaps the file.  */
+   void Close();
+   bool IsOpen() const { return (hdr!=nullptr); }
+   size_t Size() const;
+   /** Computes the key of the report whose bytes are rep[0..len-1], using
+    * the nprm parameters prm (see the description of the class).  */
+   static Key ComputeKey(const char* rep,size_t len,const double* prm,size_t nprm);
+   /** Returns true (and copies the results into var) if key is in the cache.  */
+   bool Lookup(const Key &key,G4Variants &var) const;
+   /** Inserts (or replaces) the results of key. Returns false (and nothing
+    * is inserted) if the table could not be enlarged or is full.  */
+   bool Insert(const Key &key,const G4Variants &var);
+   /** 64-bit hash of the len bytes of data.  */
+   static uint64_t HashBytes(const void* data,size_t len,uint64_t seed);
+   /** Hash of the atomic data and of the default parameters of the
+    * methods, i.e., of the tables the cached results depend on.  */
+   static uint64_t TablesHash();
+   const string &FileName() const { return fileName; }
+   static const uint64_t CACHEVERSION=3;
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   bool Map(const string &fname,size_t cap,bool create);
+   void Unmap();
+   /** Doubles the table. Returns false if the new table could not be created
+    * or could not replace the old file.  */
+   bool Grow();
+   /** Returns the slot of key, or the empty slot where it should go. At most
+    * capacity slots are probed; if the key is not there and there is no
+    * empty slot (a damaged file), the capacity is returned.  */
+   size_t FindSlot(const Key &key) const;
+   string fileName;
+   G4ResultCacheHeader* hdr;
+   G4ResultCacheEntry* entries;
+   size_t mapSize;
+   mutable std::mutex mtx;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _G4RESULTCACHE_H_ */
+
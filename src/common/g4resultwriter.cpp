@@ -0,0 +1,230 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include "g4resultwriter.h"
+#include "g4methods.h"
+#include "screenutils.h"
+
+const char* const G4ResultWriter::columns[G4ResultWriter::NCOLUMNS]={
+   "id","ok","method","freq_fact","A","alpha",
+   "lcl_zpe","scaled_zpe","g4_0K","g4_enthalpy",
+   "dhf298_horr_nist","dhf298_horr_tajti","dhf298_horr_atct",
+   "dhf298_nicolaides_nist","dhf298_nicolaides_tajti","dhf298_nicolaides_atct"
+};
+
+G4ResultWriter::G4ResultWriter() {
+   used=0;
+   fil=nullptr;
+   ownsFile=ioError=false;
+   format=JSONL;
+}
+G4ResultWriter::~G4ResultWriter() {
+   Close();
+}
+bool G4ResultWriter::GetFormat(const string &name,Format &fmt) {
+   if ( name==string("jsonl") ) {
+      fmt=JSONL;
+   } else if ( name==string("csv") ) {
+      fmt=CSV;
+   } else {
+      return false;
+   }
+   return true;
+}
+bool G4ResultWriter::Open(const string &fname,const Format fmt) {
+   Close();
+   format=fmt;
+   if ( fname.size()==0 ) {
+      fil=stdout;
+      ownsFile=false;
+   } else {
+      fil=std::fopen(fname.c_str(),"w");
+      if ( fil==nullptr ) {
+         ScreenUtils::DisplayErrorFileNotOpen(fname);
+         return false;
+      }
+      ownsFile=true;
+   }
+   ioError=false;
+   buf.resize(BUFFERSIZE);
+   used=0;
+   if ( format==CSV ) {
+      for ( size_t i=0 ; i<NCOLUMNS ; ++i ) {
+         Reserve(std::strlen(columns[i])+2);
+         if ( i>0 ) { Append(','); }
+         Append(columns[i],std::strlen(columns[i]));
+      }
+      Append('\n');
+   }
+   return true;
+}
+bool G4ResultWriter::Close() {
+   if ( fil==nullptr ) { return true; }
+   Flush();
+   if ( std::fflush(fil)!=0 ) { ioError=true; }
+   if ( ownsFile && std::fclose(fil)!=0 ) { ioError=true; }
+   fil=nullptr;
+   ownsFile=false;
+   if ( ioError ) {
+      ScreenUtils::DisplayErrorMessage("The results could not be written!");
+   }
+   return !ioError;
+}
+void G4ResultWriter::Flush() {
+   if ( used==0 || fil==nullptr ) { return; }
+   if ( std::fwrite(buf.data(),1,used,fil)!=used ) { ioError=true; }
+   used=0;
+}
+void G4ResultWriter::Reserve(const size_t n) {
+   if ( (used+n)<=buf.size() ) { return; }
+   Flush();
+   if ( n>buf.size() ) { buf.resize(n); }
+}
+void G4ResultWriter::Append(const char* str,const size_t len) {
+   std::memcpy(buf.data()+used,str,len);
+   used+=len;
+}
+void G4ResultWriter::AppendField(const size_t col) {
+   if ( format==CSV ) {
+      if ( col>0 ) { Append(','); }
+      return;
+   }
+   Append((col>0) ? ',' : '{');
+   Append('"');
+   Append(columns[col],std::strlen(columns[col]));
+   Append('"');
+   Append(':');
+}
+void G4ResultWriter::AppendQuoted(const string &str) {
+   static const char hex[]="0123456789abcdef";
+   Append('"');
+   for ( size_t i=0 ; i<str.size() ; ++i ) {
+      unsigned char c=static_cast<unsigned char>(str[i]);
+      if ( format==CSV ) {
+         if ( c=='"' ) { Append('"'); }
+         Append(char(c));
+      } else if ( c=='"' || c=='\\' ) {
+         Append('\\');
+         Append(char(c));
+      } else if ( c<0x20 ) {
+         Append("\\u00",4);
+         Append(hex[c>>4]);
+         Append(hex[c&0xF]);
+      } else {
+         Append(char(c));
+      }
+   }
+   Append('"');
+}
+void G4ResultWriter::AppendDouble(const double x) {
+   if ( !std::isfinite(x) ) {
+      if ( format==CSV ) {
+         Append("nan",3);
+      } else {
+         Append("null",4);
+      }
+      return;
+   }
+   /* 32 bytes are always available (see Write).  */
+   char* pos=buf.data()+used;
+   int len=0;
+   for ( int prec=15 ; prec<=17 ; ++prec ) {
+      len=std::snprintf(pos,32,"%.*g",prec,x);
+      if ( prec==17 || std::strtod(pos,nullptr)==x ) { break; }
+   }
+   used+=size_t(len);
+}
+void G4ResultWriter::Write(const string &id,const G4ResultRow &row) {
+   /* Worst case: every character of id escaped (6 bytes), the keys, and
+    * 32 bytes per number.  */
+   Reserve(6*id.size()+NCOLUMNS*(32+32)+64);
+   const char* mthd=G4Methods::GetName(row.method);
+   const double vals[13]={row.scalingFreqFact,row.A,row.alpha,row.lclZPE,\
+      row.scaledZPE,row.g4Energy,row.g4Enthalpy0K,row.deltaHf298K[0],\
+      row.deltaHf298K[1],row.deltaHf298K[2],row.deltaHf298K[3],\
+      row.deltaHf298K[4],row.deltaHf298K[5]};
+   AppendField(0);
+   AppendQuoted(id);
+   AppendField(1);
+   if ( row.ok ) {
+      Append((format==CSV) ? "1" : "true",(format==CSV) ? 1 : 4);
+   } else {
+      Append((format==CSV) ? "0" : "false",(format==CSV) ? 1 : 5);
+   }
+   AppendField(2);
+   Append('"');
+   Append(mthd,std::strlen(mthd));
+   Append('"');
+   for ( size_t i=0 ; i<13 ; ++i ) {
+      AppendField(3+i);
+      AppendDouble(vals[i]);
+   }
+   if ( format==JSONL ) { Append('}'); }
+   Append('\n');
+}
+void G4ResultWriter::SetRow(const G4Variants &var,G4ResultRow &row) {
+   row.method=var.method;
+   row.scalingFreqFact=var.scalingFreqFact;
+   row.A=var.A;
+   row.alpha=var.alpha;
+   row.lclZPE=var.lclZPE;
+   row.scaledZPE=var.scaledZPE;
+   row.g4Energy=var.g4Energy;
+   row.g4Enthalpy0K=var.g4Enthalpy0K[G4Variants::HORR];
+   for ( int iv=0 ; iv<G4Variants::NEVIB ; ++iv ) {
+      for ( int ir=0 ; ir<G4Variants::NREF ; ++ir ) {
+         row.deltaHf298K[iv*G4Variants::NREF+ir]=var.deltaHf298K[iv][ir];
+      }
+   }
+   row.ok=true;
+}
+void G4ResultWriter::SetFailedRow(G4ResultRow &row) {
+   const double nan=std::numeric_limits<double>::quiet_NaN();
+   row.ok=false;
+   row.method=G4Method::UNKNOWN;
+   row.scalingFreqFact=row.A=row.alpha=nan;
+   row.lclZPE=row.scaledZPE=row.g4Energy=row.g4Enthalpy0K=nan;
+   for ( int i=0 ; i<6 ; ++i ) { row.deltaHf298K[i]=nan; }
+}
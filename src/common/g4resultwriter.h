@@ -0,0 +1,128 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _G4RESULTWRITER_H_
+#define _G4RESULTWRITER_H_
+#include <cstdio>
+#include <string>
+using std::string;
+#include <vector>
+using std::vector;
+#include "calculateg4.h"
+
+/* ************************************************************************** */
+/** Results of a single report, as written by G4ResultWriter. The enthalpies
+ * of formation are stored in the same order used by the single-report mode,
+ * i.e. [HO-RR]/NIST, [HO-RR]/Tajti, [HO-RR]/ATcT, [Nicolaides]/NIST,
+ * [Nicolaides]/Tajti, and [Nicolaides]/ATcT; in kJ mol-1. Energies are
+ * in hartrees.  */
+struct G4ResultRow {
+   bool ok;
+   G4Method method;
+   double scalingFreqFact,A,alpha;
+   double lclZPE,scaledZPE;
+   double g4Energy,g4Enthalpy0K;
+   double deltaHf298K[6];
+};
+/* ************************************************************************** */
+/** Writes G4ResultRow objects as JSON Lines (one object per line) or CSV
+ * (with a header line), using a fixed schema (see columns). Non-finite
+ * values are written as null (JSON) or nan (CSV); failed reports keep their
+ * row, with ok=false. The numbers are written with the shortest %g format
+ * (15, 16, or 17 digits) that reads back to the same double.
+ * The rows are formatted with snprintf into a reusable buffer, which is
+ * written (fwrite) in blocks of BUFFERSIZE bytes, so that large batches do
+ * not pay for iostream formatting.  */
+class G4ResultWriter {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   enum Format { JSONL=0, CSV=1 };
+   G4ResultWriter();
+   ~G4ResultWriter();
+   G4ResultWriter(const G4ResultWriter &)=delete;
+   G4ResultWriter &operator=(const G4ResultWriter &)=delete;
+   /** Sets fmt from its name ("jsonl" or "csv"). Returns false if name is
+    * not a known format.  */
+   static bool GetFormat(const string &name,Format &fmt);
+   /** Opens fname (or the standard output, if fname is empty) and writes the
+    * CSV header, if needed. Returns false if the file cannot be opened.  */
+   bool Open(const string &fname,const Format fmt);
+   /** Writes one row. id is the molecule identifier (e.g. the report name).  */
+   void Write(const string &id,const G4ResultRow &row);
+   /** Flushes the buffer and closes the file (the standard output is only
+    * flushed). Returns false if an I/O error happened.  */
+   bool Close();
+   /** Copies the results var (see CalculateG4::ComputeAllVariants) into row,
+    * and sets row.ok=true.  */
+   static void SetRow(const G4Variants &var,G4ResultRow &row);
+   /** Sets all the values of row to nan and row.ok=false.  */
+   static void SetFailedRow(G4ResultRow &row);
+   static const size_t NCOLUMNS=16;
+   /** Names of the columns (CSV) or keys (JSON), in order.  */
+   static const char* const columns[NCOLUMNS];
+   static const size_t BUFFERSIZE=1<<20;
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   /** Writes the buffer to the file.  */
+   void Flush();
+   /** Makes room for (at least) n more bytes.  */
+   void Reserve(const size_t n);
+   void Append(const char c) { buf[used++]=c; }
+   void Append(const char* str,const size_t len);
+   /** Appends the key (JSON) or the separator (CSV) of the column col.  */
+   void AppendField(const size_t col);
+   /** Appends str, quoted and escaped as needed by the current format.  */
+   void AppendQuoted(const string &str);
+   void AppendDouble(const double x);
+   vector<char> buf;
+   size_t used;
+   FILE* fil;
+   bool ownsFile,ioError;
+   Format format;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _G4RESULTWRITER_H_ */
+
@@ -0,0 +1,351 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <iostream>
+using std::cout;
+using std::endl;
+#include <iomanip>
+using std::setprecision;
+#include "g4uncertainty.h"
+#include "g4batchkernel.h"
+#include "g4resultcache.h"
+#include "g4atomicproperties.h"
+#include "atom.h"
+#include "myparser.h"
+#include "philoxrng.h"
+#include "screenutils.h"
+#include "workstealingpool.h"
+
+/* Fourth word of the counter, i.e. the quantity that is perturbed. The atomic
+ * deviates do not depend on the molecule, so that all the molecules of a
+ * sample share them.  */
+#define UNCSTREAMRAW 0u
+#define UNCSTREAMFREQ 1u
+#define UNCSTREAMATOM 2u
+
+G4Uncertainty::G4Uncertainty() {
+   nSamples=100000;
+   seed=0;
+   for ( int i=0 ; i<=MAXATOMICNUMBER ; ++i ) { sigmaAtom[i]=0.0e0; }
+   for ( int k=0 ; k<NRAWENERGIES ; ++k ) { sigmaRaw[k]=0.0e0; }
+   sigmaFreq=0.0e0;
+   percent={2.5e0,5.0e1,9.75e1};
+   evibTreatment=G4Variants::HORR;
+   atomicRef=G4Variants::JANAF;
+   scalingFreqFact=A=alpha=0.0e0;
+   usrScaleFact=usrConstantA=usrAlpha=false;
+}
+void G4Uncertainty::SetAtomicSigma(const int z,const double sig) {
+   if ( z<1 || z>MAXATOMICNUMBER ) { return; }
+   sigmaAtom[z]=sig;
+}
+void G4Uncertainty::SetRawEnergySigma(const int k,const double sig) {
+   if ( k>=1 && k<=11 ) {
+      sigmaRaw[k-1]=sig;
+   } else if ( k==13 ) {
+      sigmaRaw[NRAWENERGIES-1]=sig;
+   }
+}
+void G4Uncertainty::SetVariant(const G4Variants::EvibTreatment evt,\
+      const G4Variants::AtomicReference ref) {
+   evibTreatment=evt;
+   atomicRef=ref;
+}
+bool G4Uncertainty::ReadSpecification(const string &fname) {
+   MyParser::Index idx;
+   if ( !idx.Open(fname) ) {
+      ScreenUtils::DisplayErrorFileNotOpen(fname);
+      return false;
+   }
+   bool ok=true;
+   int ival;
+   double val;
+   if ( idx.Count("UNC_SAMPLES")>0 ) {
+      if ( idx.Read("UNC_SAMPLES",ival) && ival>0 ) {
+         nSamples=size_t(ival);
+      } else {
+         ScreenUtils::DisplayErrorMessage("UNC_SAMPLES must be a positive integer!");
+         ok=false;
+      }
+   }
+   if ( idx.Count("UNC_SEED")>0 ) {
+      if ( idx.Read("UNC_SEED",ival) ) {
+         seed=uint64_t(uint32_t(ival));
+      } else {
+         ScreenUtils::DisplayErrorMessage("UNC_SEED must be an integer!");
+         ok=false;
+      }
+   }
+   if ( idx.Count("UNC_PERCENTILES")>0 ) {
+      vector<double> pc;
+      if ( idx.Read("UNC_PERCENTILES",pc) && pc.size()>0 ) {
+         percent=pc;
+      } else {
+         ScreenUtils::DisplayErrorMessage("Could not read UNC_PERCENTILES!");
+         ok=false;
+      }
+   }
+   string key;
+   for ( int k=1 ; k<=13 ; ++k ) {
+      if ( k==12 ) { continue; }
+      key=string("SIGMA_B")+std::to_string(k);
+      if ( idx.Count(key)==0 ) { continue; }
+      if ( idx.Read(key,val) ) {
+         SetRawEnergySigma(k,val);
+      } else {
+         ScreenUtils::DisplayErrorMessage(string("Could not read ")+key+string("!"));
+         ok=false;
+      }
+   }
+   if ( idx.Count("SIGMA_FREQ")>0 ) {
+      if ( idx.Read("SIGMA_FREQ",val) ) {
+         sigmaFreq=val;
+      } else {
+         ScreenUtils::DisplayErrorMessage("Could not read SIGMA_FREQ!");
+         ok=false;
+      }
+   }
+   for ( int z=1 ; z<=MAXATOMICNUMBER ; ++z ) {
+      key=string("SIGMA_DHF0_")+Atom::GetAtomicSymbol(z);
+      if ( idx.Count(key)==0 ) { continue; }
+      if ( idx.Read(key,val) ) {
+         sigmaAtom[z]=val;
+      } else {
+         ScreenUtils::DisplayErrorMessage(string("Could not read ")+key+string("!"));
+         ok=false;
+      }
+   }
+   return ok;
+}
+bool G4Uncertainty::Run(const vector<string> &repnames,const size_t nthr) {
+   results.clear();
+   results.resize(repnames.size());
+   for ( size_t i=0 ; i<repnames.size() ; ++i ) { results[i].repName=repnames[i]; }
+   WorkStealingPool pool(nthr);
+   pool.ParallelFor(results.size(),[this](size_t i){ ComputeReport(i); });
+   return NumberOfFailures()==0;
+}
+size_t G4Uncertainty::NumberOfFailures() const {
+   size_t res=0;
+   for ( size_t i=0 ; i<results.size() ; ++i ) { if ( !results[i].ok ) { ++res; } }
+   return res;
+}
+void G4Uncertainty::ComputeReport(const size_t idx) {
+   G4UncertaintyResult &res=results[idx];
+   const double nan=std::numeric_limits<double>::quiet_NaN();
+   res.ok=false;
+   res.mean=res.sigma=nan;
+   res.percentiles.assign(percent.size(),nan);
+   RawG4sData rd;
+   if ( !rd.Read(res.repName) ) {
+      res.errorMessages=rd.ErrorMessages();
+      res.errorMessages.push_back("The report could not be read!");
+      return;
+   }
+   if ( (rd.nElAlpha)!=(rd.nElBeta) ) {
+      res.errorMessages.push_back("Only closed shell molecules are accepted!");
+      return;
+   }
+   double off;
+   if ( !CalculateG4::ComputeAtomizationOffset(rd,atomicRef,off) ) {
+      res.errorMessages.push_back("There is no atomic data for some atoms!");
+      return;
+   }
+   for ( size_t i=0 ; i<rd.compZ.size() ; ++i ) {
+      if ( rd.compZ[i]>MAXATOMICNUMBER ) {
+         res.errorMessages.push_back("Only atoms of the first three rows are implemented!");
+         return;
+      }
+   }
+   const G4MethodParameters &prm=G4Methods::GetParameters(rd.g4method);
+   double par[3]; // alpha, A, frequency factor
+   par[0]=(usrAlpha ? alpha : prm.alpha);
+   par[1]=(usrConstantA ? A : prm.A);
+   par[2]=(usrScaleFact ? scalingFreqFact : prm.scalingFreqFact);
+   G4VibKernel vibk;
+   double evib[G4Variants::NEVIB];
+   vibk.Setup(rd.frequencies,par[2]);
+   vibk.ComputeEvib(2.9815e+02,evib[G4Variants::HORR],evib[G4Variants::NICOLAIDES]);
+   /* The counter word of the molecule is a hash of the data that is sampled,
+    * so that the samples do not depend on the position of the report.  */
+   const double raw[NRAWENERGIES]={rd.mp2gtbas1,rd.mp4gtbas1,rd.ccsdtg3bas1,\
+      rd.mp2gtbas2,rd.mp4gtbas2,rd.mp2gtbas3,rd.mp4gtbas3,rd.hfgtlargexp,\
+      rd.mp2gtlargexp,rd.hfgfhfb1,rd.hfgfhfb2,rd.zpe};
+   uint64_t h=G4ResultCache::HashBytes(raw,sizeof(raw),0);
+   h=G4ResultCache::HashBytes(rd.frequencies.data(),rd.frequencies.size()*sizeof(double),h);
+   h=G4ResultCache::HashBytes(rd.compZ.data(),rd.compZ.size()*sizeof(int),h);
+   h=G4ResultCache::HashBytes(rd.compCount.data(),rd.compCount.size()*sizeof(int),h);
+   const uint32_t mol=uint32_t(h^(h>>32));
+   vector<double> samples(nSamples),frq;
+   for ( size_t s0=0 ; s0<nSamples ; s0+=NBLOCK ) {
+      ComputeSamples(mol,s0,std::min(NBLOCK,nSamples-s0),rd,par,off,evib[evibTreatment],\
+            vibk,frq,&samples[s0]);
+   }
+   ComputeStatistics(samples,res);
+   res.ok=true;
+}
+void G4Uncertainty::ComputeSamples(const uint32_t mol,const size_t s0,const size_t nb,\
+      const RawG4sData &rd,const double (&par)[3],const double off,const double evib0,\
+      G4VibKernel &vibk,vector<double> &frq,double* out) const {
+   const double raw[NRAWENERGIES]={rd.mp2gtbas1,rd.mp4gtbas1,rd.ccsdtg3bas1,\
+      rd.mp2gtbas2,rd.mp4gtbas2,rd.mp2gtbas3,rd.mp4gtbas3,rd.hfgtlargexp,\
+      rd.mp2gtlargexp,rd.hfgfhfb1,rd.hfgfhfb2,(rd.zpe)*par[2]};
+   const double h2kJ=G4AtomicProperties::hartree2kJPerMole;
+   const double J2H=G4AtomicProperties::JPMole2Hartree;
+   const double ealpha=exp(-par[0]);
+   int nValEl=0;
+   for ( size_t i=0 ; i<rd.compZ.size() ; ++i ) {
+      nValEl+=(rd.compCount[i])*(Atom::GetValenceElectrons(rd.compZ[i]));
+   }
+   nValEl/=2;
+   const double hlc=-double(nValEl)*par[1];
+   /* Raw energies: one row of nb values per term. The deviates come in pairs
+    * (see PhiloxRNG::Normal2); pair k covers the terms 2k and 2k+1.  */
+   double bb[NRAWENERGIES][NBLOCK];
+   uint32_t ctr[4];
+   double z0,z1;
+   for ( int k=0 ; k<NRAWENERGIES ; ++k ) {
+      for ( size_t s=0 ; s<nb ; ++s ) { bb[k][s]=raw[k]; }
+   }
+   for ( int k=0 ; k<NRAWENERGIES ; k+=2 ) {
+      if ( sigmaRaw[k]==0.0e0 && sigmaRaw[k+1]==0.0e0 ) { continue; }
+      for ( size_t s=0 ; s<nb ; ++s ) {
+         ctr[0]=uint32_t(s0+s); ctr[1]=uint32_t(k/2); ctr[2]=mol; ctr[3]=UNCSTREAMRAW;
+         PhiloxRNG::Normal2(ctr,seed,z0,z1);
+         bb[k][s]+=sigmaRaw[k]*z0;
+         bb[k+1][s]+=sigmaRaw[k+1]*z1;
+      }
+   }
+   for ( size_t s=0 ; s<nb ; ++s ) {
+      out[s]=G4BatchKernel::CombineEnergies(bb[0][s],bb[1][s],bb[2][s],bb[3][s],bb[4][s],\
+            bb[5][s],bb[6][s],bb[7][s],bb[8][s],bb[9][s],bb[10][s],ealpha,0.0e0);
+      out[s]+=hlc+bb[NRAWENERGIES-1][s];
+   }
+   /* Vibrational energy.  */
+   if ( sigmaFreq==0.0e0 ) {
+      for ( size_t s=0 ; s<nb ; ++s ) { out[s]+=evib0*J2H+off; }
+   } else {
+      const size_t nf=rd.frequencies.size();
+      frq.resize(nf);
+      double evib[G4Variants::NEVIB];
+      for ( size_t s=0 ; s<nb ; ++s ) {
+         for ( size_t m=0 ; m<nf ; m+=2 ) {
+            ctr[0]=uint32_t(s0+s); ctr[1]=uint32_t(m/2); ctr[2]=mol; ctr[3]=UNCSTREAMFREQ;
+            PhiloxRNG::Normal2(ctr,seed,z0,z1);
+            frq[m]=rd.frequencies[m]*(1.0e0+sigmaFreq*z0);
+            if ( (m+1)<nf ) { frq[m+1]=rd.frequencies[m+1]*(1.0e0+sigmaFreq*z1); }
+         }
+         vibk.Setup(frq,par[2]);
+         vibk.ComputeEvib(2.9815e+02,evib[G4Variants::HORR],evib[G4Variants::NICOLAIDES]);
+         out[s]+=evib[evibTreatment]*J2H+off;
+      }
+   }
+   for ( size_t s=0 ; s<nb ; ++s ) { out[s]*=h2kJ; }
+   /* Atomic references (kJ mol-1); pair k covers the atomic numbers 2k+1 and 2k+2.  */
+   int nAt;
+   double sig,cnt;
+   for ( size_t i=0 ; i<rd.compZ.size() ; ++i ) {
+      nAt=rd.compZ[i];
+      sig=sigmaAtom[nAt];
+      if ( sig==0.0e0 ) { continue; }
+      cnt=double(rd.compCount[i]);
+      for ( size_t s=0 ; s<nb ; ++s ) {
+         ctr[0]=uint32_t(s0+s); ctr[1]=uint32_t((nAt-1)/2); ctr[2]=0u; ctr[3]=UNCSTREAMATOM;
+         PhiloxRNG::Normal2(ctr,seed,z0,z1);
+         out[s]+=cnt*sig*(((nAt-1)%2)==0 ? z0 : z1);
+      }
+   }
+}
+void G4Uncertainty::ComputeStatistics(vector<double> &x,G4UncertaintyResult &res) const {
+   const size_t n=x.size();
+   double sum=0.0e0;
+   for ( size_t i=0 ; i<n ; ++i ) { sum+=x[i]; }
+   res.mean=sum/double(n);
+   double ss=0.0e0,d;
+   for ( size_t i=0 ; i<n ; ++i ) { d=x[i]-res.mean; ss+=d*d; }
+   res.sigma=(n>1 ? sqrt(ss/double(n-1)) : 0.0e0);
+   /* Linear interpolation between the order statistics (the estimator used
+    * by default in R and numpy).  */
+   res.percentiles.resize(percent.size());
+   double h;
+   size_t lo;
+   for ( size_t j=0 ; j<percent.size() ; ++j ) {
+      h=(percent[j]/1.0e2)*double(n-1);
+      if ( h<0.0e0 ) { h=0.0e0; }
+      if ( h>double(n-1) ) { h=double(n-1); }
+      lo=size_t(h);
+      std::nth_element(x.begin(),x.begin()+lo,x.end());
+      double xlo=x[lo];
+      if ( (lo+1)<n ) {
+         double xhi=*std::min_element(x.begin()+lo+1,x.end());
+         res.percentiles[j]=xlo+(h-double(lo))*(xhi-xlo);
+      } else {
+         res.percentiles[j]=xlo;
+      }
+   }
+}
+void G4Uncertainty::PrintTable(ostream &ofil) const {
+   ofil << "#Report mean sigma";
+   for ( size_t j=0 ; j<percent.size() ; ++j ) { ofil << " p" << percent[j]; }
+   ofil << "\n#(Delta H_f(298.15 K), in kJ mol-1; samples: " << nSamples << ")\n";
+   std::streamsize oldprec=ofil.precision();
+   ofil << setprecision(6);
+   for ( size_t i=0 ; i<results.size() ; ++i ) {
+      const G4UncertaintyResult &r=results[i];
+      ofil << r.repName << ' ' << r.mean << ' ' << r.sigma;
+      for ( size_t j=0 ; j<r.percentiles.size() ; ++j ) { ofil << ' ' << r.percentiles[j]; }
+      ofil << '\n';
+   }
+   ofil.precision(oldprec);
+}
+void G4Uncertainty::DisplayMessages() const {
+   for ( size_t i=0 ; i<results.size() ; ++i ) {
+      const G4UncertaintyResult &r=results[i];
+      for ( size_t j=0 ; j<r.errorMessages.size() ; ++j ) {
+         ScreenUtils::DisplayErrorMessage(r.repName+string(": ")+r.errorMessages[j]);
+      }
+   }
+}
+
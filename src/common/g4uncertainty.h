@@ -0,0 +1,159 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _G4UNCERTAINTY_H_
+#define _G4UNCERTAINTY_H_
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+using std::ostream;
+#include <string>
+using std::string;
+#include <vector>
+using std::vector;
+#include "calculateg4.h"
+#include "g4vibkernel.h"
+
+/* ************************************************************************** */
+/** Statistics of the Delta H_f(298.15 K) samples of a molecule (in kJ mol-1).  */
+struct G4UncertaintyResult {
+   string repName;
+   bool ok;
+   double mean,sigma;
+   vector<double> percentiles; /*!< Same order as G4Uncertainty::Percentiles().  */
+   vector<string> errorMessages;
+};
+/* ************************************************************************** */
+/** This class propagates the uncertainties of the atomic reference data and of
+ * the raw energies to the Delta H_f(298.15 K) (atomization reactions) of a
+ * set of molecules, by Monte Carlo sampling. Every sample perturbs, with
+ * normal deviates, the experimental Delta H_f(0 K) of the atoms (one deviate
+ * per element and sample, shared by all the molecules), the raw energies
+ * B1,...,B11 and the scaled ZPE (B13), and, optionally, every vibrational
+ * frequency (relative deviation). The standard deviations are read from a
+ * file (see ReadSpecification); zero means no noise.
+ * The random numbers come from a counter-based generator (see PhiloxRNG),
+ * whose counter is made of the sample, a hash of the data of the molecule
+ * (raw energies, frequencies, and composition), and the perturbed quantity;
+ * hence, the results depend neither on the number of threads nor on the
+ * order of the reports.
+ * The molecules are distributed among the threads (see WorkStealingPool),
+ * and the samples of a molecule are evaluated in blocks of NBLOCK, one
+ * loop per term. The frequencies are resampled only if SIGMA_FREQ is not
+ * zero; otherwise, Evib is computed once per molecule.
+ * By default, the HO-RR vibrational energy and the JANAF atomic data are
+ * used, and the constants of the method of each report (see G4Methods).
+ * The multireference corrections (T1Diag, LHGap) are not included.  */
+class G4Uncertainty {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   G4Uncertainty();
+   /** Reads the number of samples and the standard deviations from fname.
+    * The recognized keywords (each one followed by a line with its value) are:
+    *    UNC_SAMPLES (default: 100000), UNC_SEED (default: 0),
+    *    UNC_PERCENTILES (number of values, followed by the values;
+    *                     default: 2.5 50 97.5),
+    *    SIGMA_B1,...,SIGMA_B11, SIGMA_B13 (in hartrees),
+    *    SIGMA_FREQ (relative, e.g. 0.01 for 1%), and
+    *    SIGMA_DHF0_X (in kJ mol-1), where X is an atomic symbol (e.g. SIGMA_DHF0_C).  */
+   bool ReadSpecification(const string &fname);
+   void SetNumberOfSamples(const size_t ns) { nSamples=(ns>0 ? ns : 1); }
+   void SetSeed(const uint64_t sd) { seed=sd; }
+   /** Sets the standard deviation of the experimental Delta H_f(0 K) of the
+    * atom whose atomic number is z (in kJ mol-1).  */
+   void SetAtomicSigma(const int z,const double sig);
+   /** Sets the standard deviation of the raw energy B_k, k=1,...,11, or
+    * k=13 for the scaled ZPE (in hartrees).  */
+   void SetRawEnergySigma(const int k,const double sig);
+   void SetFrequencySigma(const double sig) { sigmaFreq=sig; }
+   void SetPercentiles(const vector<double> &pc) { percent=pc; }
+   const vector<double> &Percentiles() const { return percent; }
+   /** Selects the variant used for the Delta H_f.  */
+   void SetVariant(const G4Variants::EvibTreatment evt,const G4Variants::AtomicReference ref);
+   /** The following setters override the constants of the methods of the
+    * reports (see CalculateG4).  */
+   void SetScalingFreqencyFactor(const double ff) { usrScaleFact=true; scalingFreqFact=ff; }
+   void SetConstantA(const double aa) { usrConstantA=true; A=aa; }
+   void SetAlpha(const double aa) { usrAlpha=true; alpha=aa; }
+   /** Samples the reports repnames, using nthr threads (nthr=0 means all the
+    * available hardware threads). Returns false if some report failed.  */
+   bool Run(const vector<string> &repnames,const size_t nthr=0);
+   const vector<G4UncertaintyResult> &Results() const { return results; }
+   size_t NumberOfFailures() const;
+   /** Writes one row per report: mean, standard deviation, and percentiles.
+    * Failed reports are written with nan values.  */
+   void PrintTable(ostream &ofil) const;
+   /** Displays (in order) the errors found for every report.  */
+   void DisplayMessages() const;
+   static const size_t NBLOCK=256;
+   static const int NRAWENERGIES=12; /*!< B1,...,B11, and B13.  */
+   static const int MAXATOMICNUMBER=18;
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   /** Samples the report results[idx].repName, and saves its statistics.  */
+   void ComputeReport(const size_t idx);
+   /** Computes the nb samples s0,...,(s0+nb-1) of Delta H_f of a molecule;
+    * mol is its counter word (see the description of the class).  */
+   void ComputeSamples(const uint32_t mol,const size_t s0,const size_t nb,const RawG4sData &rd,\
+         const double (&par)[3],const double off,const double evib0,G4VibKernel &vibk,\
+         vector<double> &frq,double* out) const;
+   /** Mean, standard deviation, and percentiles of x (x is reordered).  */
+   void ComputeStatistics(vector<double> &x,G4UncertaintyResult &res) const;
+   vector<G4UncertaintyResult> results;
+   size_t nSamples;
+   uint64_t seed;
+   double sigmaAtom[MAXATOMICNUMBER+1]; /*!< In kJ mol-1.  */
+   double sigmaRaw[NRAWENERGIES]; /*!< In hartrees.  */
+   double sigmaFreq;
+   vector<double> percent;
+   G4Variants::EvibTreatment evibTreatment;
+   G4Variants::AtomicReference atomicRef;
+   double scalingFreqFact,A,alpha;
+   bool usrScaleFact,usrConstantA,usrAlpha;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _G4UNCERTAINTY_H_ */
+
@@ -0,0 +1,168 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cmath>
+#include "g4vibkernel.h"
+#include "g4atomicproperties.h"
+#include "physicalconstants.h"
+
+G4VibKernel::G4VibKernel() {
+   zpe=0.0e0;
+   scaleFact=1.0e0;
+}
+void G4VibKernel::Setup(const vector<double> &freqs,const double ff) {
+   const size_t n=freqs.size();
+   hnu.resize(n);
+   lowFreq.resize(n);
+   scaleFact=ff;
+   double fc100=100.0e0*ff*PhysicalConstants::c;
+   double h=PhysicalConstants::h;
+   const double* __restrict__ f=freqs.data();
+   double* __restrict__ hn=hnu.data();
+   double* __restrict__ msk=lowFreq.data();
+   for ( size_t i=0 ; i<n ; ++i ) {
+      hn[i]=fc100*f[i]*h;
+      msk[i]=( (ff*f[i])<NICOLAIDESLOWERBOUND ) ? 1.0e0 : 0.0e0;
+   }
+   zpe=0.0e0;
+   for ( size_t i=0 ; i<n ; ++i ) { zpe+=0.5e0*hn[i]; }
+   zpe*=PhysicalConstants::NA*G4AtomicProperties::JPMole2Hartree; // in hartrees; scaled
+}
+void G4VibKernel::ComputeEvib(const double tt,double &evibho,double &evibnic) {
+   ComputeEvib(&tt,1,&evibho,&evibnic);
+}
+void G4VibKernel::ComputeEvib(const vector<double> &tt,vector<double> &evibho,\
+      vector<double> &evibnic) {
+   evibho.resize(tt.size());
+   evibnic.resize(tt.size());
+   if ( tt.size()==0 ) { return; }
+   ComputeEvib(tt.data(),tt.size(),evibho.data(),evibnic.data());
+}
+void G4VibKernel::ComputeEvib(const double* tt,const size_t nt,double* evibho,\
+      double* evibnic) {
+   ookT.resize(nt);
+   halfRT.resize(nt);
+   for ( size_t k=0 ; k<nt ; ++k ) {
+      ookT[k]=1.0e0/(tt[k]*PhysicalConstants::kB);
+      halfRT[k]=0.5e0*(PhysicalConstants::R*tt[k]); // In Joules/mol
+      evibho[k]=evibnic[k]=0.0e0;
+   }
+   const double NA=PhysicalConstants::NA;
+   const size_t n=hnu.size();
+   const double* __restrict__ hn=hnu.data();
+   const double* __restrict__ msk=lowFreq.data();
+   const double* __restrict__ okt=ookT.data();
+   const double* __restrict__ hrt=halfRT.data();
+   double term;
+   /* The inner loop runs over the temperatures, so that each accumulator
+    * receives the terms in the order of the frequencies.  */
+   for ( size_t i=0 ; i<n ; ++i ) {
+      for ( size_t k=0 ; k<nt ; ++k ) {
+         term=(NA*hn[i]/(exp(hn[i]*okt[k])-1.0e0));
+         evibho[k]+=term;
+         evibnic[k]+=( (msk[i]!=0.0e0) ? hrt[k] : term );
+      }
+   }
+}
+void G4VibKernel::ComputeEvibAndDerivative(const double tt,double &evibho,double &evibnic,\
+      double &devibho,double &devibnic) {
+   const double ookT0=1.0e0/(tt*PhysicalConstants::kB);
+   const double halfRT0=0.5e0*(PhysicalConstants::R*tt);
+   const double NA=PhysicalConstants::NA;
+   const double ooff=1.0e0/scaleFact;
+   double x,ex,em1,term,dterm;
+   evibho=evibnic=devibho=devibnic=0.0e0;
+   for ( size_t i=0 ; i<hnu.size() ; ++i ) {
+      x=hnu[i]*ookT0;
+      ex=exp(x);
+      em1=ex-1.0e0;
+      term=(NA*hnu[i]/em1);
+      /* h nu_i is proportional to ff, hence d(term)/d(ff)=(term/ff)(1-x e^x/(e^x-1)).  */
+      dterm=term*ooff*(1.0e0-x/(1.0e0-1.0e0/ex));
+      evibho+=term;
+      devibho+=dterm;
+      if ( lowFreq[i]!=0.0e0 ) {
+         evibnic+=halfRT0;
+      } else {
+         evibnic+=term;
+         devibnic+=dterm;
+      }
+   }
+}
+void G4VibKernel::ComputeThermo(const double* tt,const size_t nt,double* evib,\
+      double* svib,double* cvvib) {
+   ookT.resize(nt);
+   for ( size_t k=0 ; k<nt ; ++k ) {
+      ookT[k]=1.0e0/(tt[k]*PhysicalConstants::kB);
+      evib[k]=svib[k]=cvvib[k]=0.0e0;
+   }
+   const double NA=PhysicalConstants::NA;
+   const size_t n=hnu.size();
+   const double* __restrict__ hn=hnu.data();
+   double x,ex,em1,emx;
+   size_t kend;
+   for ( size_t kbeg=0 ; kbeg<nt ; kbeg+=THERMOTBLOCK ) {
+      kend=( (kbeg+THERMOTBLOCK)<nt ? (kbeg+THERMOTBLOCK) : nt );
+      const double* __restrict__ okt=ookT.data()+kbeg;
+      double* __restrict__ ev=evib+kbeg;
+      double* __restrict__ sv=svib+kbeg;
+      double* __restrict__ cv=cvvib+kbeg;
+      for ( size_t i=0 ; i<n ; ++i ) {
+         for ( size_t k=0 ; k<(kend-kbeg) ; ++k ) {
+            x=hn[i]*okt[k];
+            ex=exp(x);
+            em1=ex-1.0e0;
+            emx=1.0e0/ex;
+            ev[k]+=(NA*hn[i]/em1);
+            /* x/(e^x-1)-ln(1-e^{-x}), and x^2 e^x/(e^x-1)^2, written so that
+             * they vanish (instead of giving nan) if e^x overflows.  */
+            sv[k]+=(x/em1-log1p(-emx));
+            cv[k]+=(x*x/(em1*(1.0e0-emx)));
+         }
+      }
+   }
+   const double R=PhysicalConstants::R;
+   for ( size_t k=0 ; k<nt ; ++k ) {
+      svib[k]*=R;
+      cvvib[k]*=R;
+   }
+}
+
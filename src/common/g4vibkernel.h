@@ -0,0 +1,109 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _G4VIBKERNEL_H_
+#define _G4VIBKERNEL_H_
+#include <cstddef>
+#include <vector>
+using std::vector;
+
+/** Frequencies (scaled, in cm-1) below this value are treated with
+ * the Nicolaides correction (their contribution to Evib is RT/2).  */
+#ifndef NICOLAIDESLOWERBOUND
+#define NICOLAIDESLOWERBOUND 260.0e0
+#endif
+
+/* ************************************************************************** */
+/** This class computes the vibrational energy (HO-RR, and with the
+ * Nicolaides correction) and the ZPE of a molecule. The quantities
+ * that do not depend on the temperature (h nu_i, and the Nicolaides
+ * mask) are computed once, in Setup(), as contiguous arrays; afterwards,
+ * the energies for one or several temperatures are evaluated in a single
+ * sweep over the frequencies, with a branchless blend for the Nicolaides
+ * cutoff. The terms are accumulated in the order of the frequencies, hence
+ * the results are identical to the ones of the plain (scalar) loop.  */
+class G4VibKernel {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   G4VibKernel();
+   /** Precomputes h nu_i (in J) and the Nicolaides mask, for the frequencies
+    * freqs (unscaled, in cm-1), and the scaling factor ff. Also computes
+    * the ZPE.  */
+   void Setup(const vector<double> &freqs,const double ff);
+   size_t NumberOfModes() const { return hnu.size(); }
+   /** Returns the (scaled) ZPE, in hartrees.  */
+   double ZPE() const { return zpe; }
+   /** Computes the vibrational energy (in J/mol, without ZPE) at temperature
+    * tt (in K), within the HO-RR approximation (evibho), and with the
+    * Nicolaides correction (evibnic).  */
+   void ComputeEvib(const double tt,double &evibho,double &evibnic);
+   /** Same as above, for nt temperatures tt[0..nt-1], in one sweep over
+    * the frequencies.  */
+   void ComputeEvib(const double* tt,const size_t nt,double* evibho,double* evibnic);
+   void ComputeEvib(const vector<double> &tt,vector<double> &evibho,vector<double> &evibnic);
+   /** Computes, for the nt temperatures tt[0..nt-1], the vibrational energy
+    * evib (HO-RR, in J/mol, without ZPE; identical to the one of ComputeEvib),
+    * entropy svib, and heat capacity cvvib (both in J/(mol K)). The temperatures
+    * are processed in blocks of THERMOTBLOCK; within a block, one exponential
+    * is evaluated per (mode, temperature), and shared by the three sums.  */
+   void ComputeThermo(const double* tt,const size_t nt,double* evib,double* svib,double* cvvib);
+   /** Same as ComputeEvib(tt,evibho,evibnic), but also computes the derivatives
+    * of evibho and evibnic with respect to the scaling factor (see Setup).
+    * The Nicolaides mask is considered constant.  */
+   void ComputeEvibAndDerivative(const double tt,double &evibho,double &evibnic,\
+         double &devibho,double &devibnic);
+   static const size_t THERMOTBLOCK=64;
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   vector<double> hnu; /*!< h nu_i, in Joules (scaled).  */
+   vector<double> lowFreq; /*!< 1 if the i-th mode is below NICOLAIDESLOWERBOUND, 0 otherwise.  */
+   double zpe;
+   double scaleFact; /*!< The scaling factor used in Setup.  */
+   vector<double> ookT,halfRT; /*!< Per temperature; reused between calls.  */
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _G4VIBKERNEL_H_ */
+
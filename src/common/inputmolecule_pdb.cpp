@@ -146,6 +146,7 @@ void InputMoleculePDB::ReloadAtoms() {
       CopyAtomCoordinates(buffer[bPos],x);
       for ( size_t j=0 ; j<3 ; ++j ) { atom[i].x[j]=x[j]; }
    }
+   InvalidateCellList();
 }
 void InputMoleculePDB::CopyAtomCoordinates(const string &line,vector<double> &x) {
    x[0]=std::stod(line.substr(31,8));
@@ -0,0 +1,107 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "mappedfile.h"
+
+MappedFile::MappedFile() {
+   isopen=false;
+   mapped=false;
+   data=nullptr;
+   size=0;
+}
+MappedFile::MappedFile(const string &fname) : MappedFile() {
+   Open(fname);
+}
+MappedFile::~MappedFile() {
+   Close();
+}
+bool MappedFile::Open(const string &fname) {
+   Close();
+   int fd=open(fname.c_str(),O_RDONLY);
+   if ( fd<0 ) { return false; }
+   struct stat st;
+   if ( fstat(fd,&st)!=0 ) {
+      close(fd);
+      return false;
+   }
+   size=size_t(st.st_size);
+   if ( size==0 ) {
+      close(fd);
+      isopen=true;
+      return true;
+   }
+   void* ptr=mmap(nullptr,size,PROT_READ,MAP_PRIVATE,fd,0);
+   if ( ptr!=MAP_FAILED ) {
+      mapped=true;
+      data=static_cast<const char*>(ptr);
+#ifdef MADV_SEQUENTIAL
+      madvise(ptr,size,MADV_SEQUENTIAL);
+#endif
+   } else {
+      buffer.resize(size);
+      size_t nread=0;
+      ssize_t nn;
+      while ( nread<size ) {
+         nn=read(fd,buffer.data()+nread,size-nread);
+         if ( nn<=0 ) { break; }
+         nread+=size_t(nn);
+      }
+      buffer.resize(nread);
+      size=nread;
+      data=buffer.data();
+   }
+   close(fd);
+   isopen=true;
+   return true;
+}
+void MappedFile::Close() {
+   if ( mapped ) { munmap(const_cast<char*>(data),size); }
+   buffer.clear();
+   isopen=false;
+   mapped=false;
+   data=nullptr;
+   size=0;
+}
+
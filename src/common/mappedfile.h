@@ -0,0 +1,85 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _MAPPEDFILE_H_
+#define _MAPPEDFILE_H_
+#include <cstddef>
+#include <string>
+using std::string;
+#include <vector>
+using std::vector;
+
+/* ************************************************************************** */
+/** Read-only view of a whole file. The file is memory mapped (mmap);
+ * if this is not possible (e.g. some network file systems), the file is
+ * read into an internal buffer with a single read loop. Either way, Data()
+ * points to Size() contiguous bytes (not null-terminated), which are valid
+ * until Close() is called or the object is destroyed.  */
+class MappedFile {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   MappedFile();
+   explicit MappedFile(const string &fname);
+   ~MappedFile();
+   MappedFile(const MappedFile &)=delete;
+   MappedFile &operator=(const MappedFile &)=delete;
+   /** Returns false if the file could not be opened.  */
+   bool Open(const string &fname);
+   void Close();
+   bool IsOpen() const { return isopen; }
+   const char* Data() const { return data; }
+   size_t Size() const { return size; }
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   bool isopen;
+   bool mapped;
+   const char* data;
+   size_t size;
+   vector<char> buffer;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _MAPPEDFILE_H_ */
+
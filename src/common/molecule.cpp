@@ -47,31 +47,28 @@ using std::cerr;
 #include <iomanip>
 using std::setprecision;
 #include <algorithm>
+#include <utility>
 #include <cmath>
 #include <cassert>
 #include "screenutils.h"
 #include "molecule.h"
 #include "matrixvectoroperations3d.h"
+#include "workstealingpool.h"
+#include "atomspatialhash.h"
 
 Molecule::Molecule() {
    Init();
 }
 void Molecule::Init() {
    atom.clear();
-   for ( size_t i=0 ; i<bond.size() ; ++i ) { bond[i].clear(); }
+   bondStart.clear();
    bond.clear();
-   for ( size_t i=0 ; i<bndDist.size() ; ++i ) { bndDist[i].clear(); }
    bndDist.clear();
-   for ( size_t i=0 ; i<cell.size() ; ++i ) {
-      for ( size_t j=0 ; j<cell[i].size() ; ++j ) {
-         for ( size_t k=0 ; k<cell[i][j].size() ; ++k ) {
-            cell[i][j][k].clear();
-         }
-         cell[i][j].clear();
-      }
-      cell[i].clear();
-   }
-   cell.clear();
+   cellStart.clear();
+   cellAtom.clear();
+   for ( size_t i=0 ; i<3 ; ++i ) { nCell[i]=0; cellOrig[i]=0.0e0; }
+   cellLen=0.0e0;
+   cellListOk=false;
    cm.resize(3);
    cd.resize(3);
    xmin.resize(3);
@@ -81,30 +78,23 @@ void Molecule::Init() {
 }
 Molecule::~Molecule() {
    atom.clear();
-   for ( size_t i=0 ; i<bond.size() ; ++i ) { bond[i].clear(); }
+   bondStart.clear();
    bond.clear();
-   for ( size_t i=0 ; i<bndDist.size() ; ++i ) { bndDist[i].clear(); }
    bndDist.clear();
-   for ( size_t i=0 ; i<cell.size() ; ++i ) {
-      for ( size_t j=0 ; j<cell[i].size() ; ++j ) {
-         for ( size_t k=0 ; k<cell[i][j].size() ; ++k ) {
-            cell[i][j][k].clear();
-         }
-         cell[i][j].clear();
-      }
-      cell[i].clear();
-   }
-   cell.clear();
+   cellStart.clear();
+   cellAtom.clear();
    cm.clear();
    cd.clear();
    origCent.clear();
    imsetup=false;
 }
 void Molecule::AddAtom(vector<double> &ux,int an) {
-   atom.push_back(Atom(ux,an));
+   atom.push_back(ux[0],ux[1],ux[2],an);
+   cellListOk=false;
 }
 void Molecule::AddAtom(vector<double> &ux,string &usymb) {
-   atom.push_back(Atom(ux,usymb));
+   atom.push_back(ux[0],ux[1],ux[2],Atom::GetAtomicNumberFromSymbol(usymb));
+   cellListOk=false;
 }
 void Molecule::DisplayAtomProperties() {
    size_t k=atom.size();
@@ -115,22 +105,15 @@ void Molecule::DisplayProperties() {
    DisplayBondProperties();
 }
 void Molecule::DisplayBondProperties() {
-   size_t nb=bond.size();
-   cout << "There are " << nb << " bonds." << '\n';
-   //*
-   for ( size_t i=0 ; i<nb ; ++i ) {
+   cout << "There are " << bond.size() << " bonds." << '\n';
+   if ( bondStart.size()!=(atom.size()+1) ) { return; }
+   for ( size_t i=0 ; i<atom.size() ; ++i ) {
       cout << "   Bonded: " << i << " (" << std::setw(2) << atom[i].symbol << "): ";
-      for ( size_t j=0 ; j<bond[i].size() ; ++j ) {
-         cout << bond[i][j] << '(' << std::setw(2) << atom[bond[i][j]].symbol << ") ";
+      for ( size_t k=bondStart[i] ; k<bondStart[i+1] ; ++k ) {
+         cout << bond[k] << '(' << std::setw(2) << atom[bond[k]].symbol << ") ";
       }
-     // cout << setprecision(4);
-     // cout << "\nDistances: " << i << " (" << std::setw(2) << atom[i].symbol << "): ";
-     // for ( size_t j=0 ; j<bond[i].size() ; ++j ) {
-     //    cout << std::setw(5) << bndDist[i][j] << ' ';
-     // }
       cout << '\n';
    }
-   // */
 }
 void Molecule::SortCoordinates() {
    if ( !imsetup ) {
@@ -143,11 +126,13 @@ void Molecule::SortCoordinates() {
    //Sorts second column...
    size_t n=atom.size()-1;
    size_t count,currpos;
+   const double* x=atom.X();
+   const double* y=atom.Y();
    for ( size_t i=0 ; i<n ; ++i ) {
       count=0;
       currpos=i;
       //cout << "currpos: " << currpos << "(" << i << ")";
-      while ( currpos<n && (fabs(atom[currpos+1].x[0]-atom[currpos].x[0])<=SINGLECOORDEPS) ) { //see globaldefs.h
+      while ( currpos<n && (fabs(x[currpos+1]-x[currpos])<=SINGLECOORDEPS) ) { //see globaldefs.h
          ++count;
          ++currpos;
       }
@@ -163,8 +148,8 @@ void Molecule::SortCoordinates() {
       currpos=i;
       //cout << "currpos: " << currpos << "(" << i << ")";
       while ( currpos<n &&\
-              (fabs(atom[currpos+1].x[1]-atom[currpos].x[1])<=SINGLECOORDEPS) &&\
-              (fabs(atom[currpos+1].x[0]-atom[currpos].x[0])<=SINGLECOORDEPS) ) { //see globaldefs.h
+              (fabs(y[currpos+1]-y[currpos])<=SINGLECOORDEPS) &&\
+              (fabs(x[currpos+1]-x[currpos])<=SINGLECOORDEPS) ) { //see globaldefs.h
          ++count;
          ++currpos;
       }
@@ -176,18 +161,17 @@ void Molecule::SortCoordinates() {
    }
 }
 void Molecule::QuickSort(int high,int low,int srtIdx) {
+   cellListOk=false;
    int i=low;
    int j=high;
    int hplo2=(high+low)/2;
-   double mid[3];
-   mid[0]=atom[hplo2].x[0];
-   mid[1]=atom[hplo2].x[1];
-   mid[2]=atom[hplo2].x[2];
+   const double* c=atom.Coordinate(size_t(srtIdx));
+   double mid=c[hplo2];
    do {
-      while (atom[i].x[srtIdx]<mid[srtIdx]) { ++i; }
-      while (atom[j].x[srtIdx]>mid[srtIdx]) { --j; }
+      while (c[i]<mid) { ++i; }
+      while (c[j]>mid) { --j; }
       if ( i<=j ) {
-         std::swap(atom[i],atom[j]);
+         atom.Swap(i,j);
          ++i;
          --j;
       }
@@ -199,7 +183,7 @@ string Molecule::EmpiricalFormula() const {
    size_t n=MAXATNUMDEF; //see globaldefs.h
    vector<int> count(n);
    for ( size_t i=0 ; i<n ; ++i ) { count[i]=0; }
-   for ( size_t i=0 ; i<atom.size() ; ++i ) { count[atom[i].num-1]++; }
+   for ( size_t i=0 ; i<atom.size() ; ++i ) { count[atom.AtomicNumber(i)-1]++; }
    string res;
    for ( size_t i=0 ; i<n ; ++i ) {
       if ( count[i]>0 ) {
@@ -216,7 +200,7 @@ int Molecule::CountAtomsOfType(string ss) {
 int Molecule::CountAtomsOfType(int nn) {
    int count=0;
    for ( size_t i=0 ; i<atom.size() ; ++i ) {
-      if ( atom[i].num==nn ) { ++count; }
+      if ( atom.AtomicNumber(i)==nn ) { ++count; }
    }
    return count;
 }
@@ -225,8 +209,11 @@ void Molecule::DetermineBoundingBox() {
    double bmin[3]={1.0e+50,1.0e+50,1.0e+50};
    double bmax[3]={-1.0e+50,-1.0e+50,-1.0e+50};
    double xx[3];
+   const double* x=atom.X();
+   const double* y=atom.Y();
+   const double* z=atom.Z();
    for ( size_t i=0 ; i<nNuc ; ++i ) {
-      for ( size_t j=0 ; j<3 ; ++j ) { xx[j]=atom[i].x[j]; }
+      xx[0]=x[i]; xx[1]=y[i]; xx[2]=z[i];
       if ( xx[0]<bmin[0] ) { bmin[0]=xx[0]; }
       if ( xx[1]<bmin[1] ) { bmin[1]=xx[1]; }
       if ( xx[2]<bmin[2] ) { bmin[2]=xx[2]; }
@@ -244,18 +231,24 @@ void Molecule::ComputeCenterOfMass() {
    if ( !ImSetup() ) { cout << __FILE__ << ", line: " << __LINE__ << '\n'; return; }
    for ( size_t i=0 ; i<3 ; ++i ) { cm[i]=0.0e0; }
    double m,totmass=0.0e0;
+   const double* x=atom.X();
+   const double* y=atom.Y();
+   const double* z=atom.Z();
    for ( size_t i=0 ; i<atom.size() ; ++i ) {
-      m=atom[i].weight;
+      m=Atom::GetAtomicWeight(atom.AtomicNumber(i));
       totmass+=m;
-      for ( size_t j=0 ; j<3 ; ++j ) { cm[j]+= (m*atom[i].x[j]); }
+      cm[0]+=(m*x[i]);
+      cm[1]+=(m*y[i]);
+      cm[2]+=(m*z[i]);
    }
    for ( size_t i=0 ; i<3 ; ++i ) { cm[i]/=totmass; }
 }
 void Molecule::ComputeCentroid() {
    if ( !ImSetup() ) { cout << __FILE__ << ", line: " << __LINE__ << '\n'; return; }
    for ( size_t i=0 ; i<3 ; ++i ) { cd[i]=0.0e0; }
-   for ( size_t i=0 ; i<atom.size() ; ++i ) {
-      for ( size_t j=0 ; j<3 ; ++j ) { cd[j]+=atom[i].x[j]; }
+   for ( size_t j=0 ; j<3 ; ++j ) {
+      const double* x=atom.Coordinate(j);
+      for ( size_t i=0 ; i<atom.size() ; ++i ) { cd[j]+=x[i]; }
    }
    double f=1.0e0/double(atom.size());
    for ( size_t i=0 ; i<3 ; ++i ) { cd[i]*=f; }
@@ -268,147 +261,205 @@ bool Molecule::ImSetup() const {
 }
 void Molecule::CenterAtCentroid() {
    ComputeCentroid();
-   for ( size_t i=0 ; i<atom.size() ; ++i ) {
-      atom[i].x[0]-=cd[0];
-      atom[i].x[1]-=cd[1];
-      atom[i].x[2]-=cd[2];
-   }
+   Translate(-cd[0],-cd[1],-cd[2]);
    for ( size_t i=0 ; i<3 ; ++i ) { origCent[i]-=cd[i]; cd[i]=0.0e0; }
 }
 void Molecule::CenterAtCenterOfMass() {
    ComputeCenterOfMass();
-   for ( size_t i=0 ; i<atom.size() ; ++i ) {
-      atom[i].x[0]-=cm[0];
-      atom[i].x[1]-=cm[1];
-      atom[i].x[2]-=cm[2];
-   }
+   Translate(-cm[0],-cm[1],-cm[2]);
    for ( size_t i=0 ; i<3 ; ++i ) { origCent[i]-=cm[i]; cm[i]=0.0e0; }
 }
 void Molecule::ResetOriginOfCoordinates() {
-   for ( size_t i=0 ; i<atom.size() ; ++i ) {
-      atom[i].x[0]-=origCent[0];
-      atom[i].x[1]-=origCent[1];
-      atom[i].x[2]-=origCent[2];
-   }
+   Translate(-origCent[0],-origCent[1],-origCent[2]);
    for ( size_t i=0 ; i<3 ; ++i ) { origCent[i]=0.0e0; }
 }
-void Molecule::SetupBonds() {
-   SetupCells();
-   int nNuc=int(atom.size());
-   if ( int(bond.size()) != nNuc ) {
-      for ( int i=0 ; i<int(bond.size()) ; ++i ) { bond[i].clear(); }
-      bond.resize(nNuc);
-      for ( int i=0 ; i<nNuc ; ++i ) {
-         bond[i].reserve(8);
-      }
-   }
-   if ( int(bndDist.size()) != nNuc ) {
-      for ( int i=0 ; i<int(bndDist.size()) ; ++i ) { bndDist[i].clear(); }
-      bndDist.resize(nNuc);
-      for ( int i=0 ; i<nNuc ; ++i ) {
-         bndDist[i].reserve(8);
-      }
-   }
+void Molecule::SetupBonds(const size_t nthr) {
+   if ( !cellListOk ) { SetupCells(); }
+   const int nNuc=int(atom.size());
+   bondStart.assign(nNuc+1,0);
+   bond.clear();
+   bndDist.clear();
    maxBondDist=-1.0e+50;
-   double d,vdwd,clsstatd=1.0e+50;
-   int al,am;
-   for ( int i=1 ; i<int(cell.size()-1) ; ++i ) {
-      for ( int j=1 ; j<int(cell[i].size()-1) ; ++j ) {
-         for ( int k=1 ; k<int(cell[i][j].size()-1) ; ++k ) {
-            for ( int l=0 ; l<int(cell[i][j][k].size()) ; ++l ) {
-               al=cell[i][j][k][l];
-               for ( int p=-1 ; p<2 ; ++p ) {
-                  for ( int q=-1 ; q<2 ; ++q ) {
-                     for ( int r=-1 ; r<2 ; ++r ) {
-                        for ( int s=0 ; s<int(cell[i+p][j+q][k+r].size()) ; ++s ) {
-                           am=cell[i+p][j+q][k+r][s];
+   double clsstatd=1.0e+50;
+   if ( nNuc>0 ) {
+      double vdwr[256];
+      for ( int z=0 ; z<256 ; ++z ) { vdwr[z]=0.0e0; }
+      for ( int z=1 ; z<=MAXATNUMDEF ; ++z ) { vdwr[z]=VdWRadius(z); }
+      /* Blocks of consecutive cells with (roughly) the same number of atoms.
+       * Each block is a task; its bonds are saved in its own buffers, and
+       * then copied in the order of the atoms.  */
+      const int nCells=int(cellStart.size())-1;
+      int nBlk=(nNuc+MOLECULEBONDBLOCKSIZE-1)/MOLECULEBONDBLOCKSIZE;
+      vector<int> blkCell(1,0);
+      for ( int c=0,b=1 ; c<nCells && b<nBlk ; ++c ) {
+         if ( double(cellStart[c+1])>=(double(nNuc)*double(b)/double(nBlk)) ) {
+            blkCell.push_back(c+1);
+            ++b;
+         }
+      }
+      if ( blkCell.back()<nCells ) { blkCell.push_back(nCells); }
+      nBlk=int(blkCell.size())-1;
+      vector<vector<int> > blkBond(nBlk);
+      vector<vector<double> > blkDist(nBlk);
+      vector<double> blkMaxD(nBlk,-1.0e+50),blkMinD2(nBlk,1.0e+100);
+      const double* x=atom.X();
+      const double* y=atom.Y();
+      const double* z=atom.Z();
+      auto findBonds=[&](size_t blk) {
+         vector<std::pair<int,double> > nbr;
+         nbr.reserve(16);
+         double dx,dy,dz,d2,vdwd,maxd=-1.0e+50,mind2=1.0e+100;
+         int ci,cj,ck,al,am,cn;
+         for ( int c=blkCell[blk] ; c<blkCell[blk+1] ; ++c ) {
+            ci=c/(nCell[1]*nCell[2]);
+            cj=(c/nCell[2])%nCell[1];
+            ck=c%nCell[2];
+            for ( int l=cellStart[c] ; l<cellStart[c+1] ; ++l ) {
+               al=cellAtom[l];
+               nbr.clear();
+               for ( int p=ci-1 ; p<=ci+1 ; ++p ) {
+                  if ( p<0 || p>=nCell[0] ) { continue; }
+                  for ( int q=cj-1 ; q<=cj+1 ; ++q ) {
+                     if ( q<0 || q>=nCell[1] ) { continue; }
+                     for ( int r=ck-1 ; r<=ck+1 ; ++r ) {
+                        if ( r<0 || r>=nCell[2] ) { continue; }
+                        cn=CellIndex(p,q,r);
+                        for ( int s=cellStart[cn] ; s<cellStart[cn+1] ; ++s ) {
+                           am=cellAtom[s];
                            if ( al>=am ) { continue; }
-                           d=MatrixVectorOperations3D::Distance(atom[al].x,atom[am].x);
-                           vdwd=(atom[al].GetVDWRadius()+atom[am].GetVDWRadius());
-                           if ( d<=vdwd ) {
-                              bond[al].push_back(am);
-                              bndDist[al].push_back(d);
-                              if ( d>maxBondDist ) { maxBondDist=d; }
-                           }
-                           if ( d<clsstatd ) {clsstatd=d;}
+                           dx=x[al]-x[am];
+                           dy=y[al]-y[am];
+                           dz=z[al]-z[am];
+                           d2=0.0e0;
+                           d2+=(dx*dx);
+                           d2+=(dy*dy);
+                           d2+=(dz*dz);
+                           vdwd=vdwr[atom.AtomicNumber(al)]+vdwr[atom.AtomicNumber(am)];
+                           if ( d2<=(vdwd*vdwd) ) { nbr.push_back(std::make_pair(am,sqrt(d2))); }
+                           if ( d2<mind2 ) { mind2=d2; }
                         }
                      }
                   }
                }
+               std::sort(nbr.begin(),nbr.end());
+               bondStart[al+1]=nbr.size();
+               for ( size_t k=0 ; k<nbr.size() ; ++k ) {
+                  blkBond[blk].push_back(nbr[k].first);
+                  blkDist[blk].push_back(nbr[k].second);
+                  if ( nbr[k].second>maxd ) { maxd=nbr[k].second; }
+               }
             }
          }
-      }
-   }
-   /*
-   for ( int i=0 ; i<nNuc ; ++i ) {
-      for ( int j=i+1 ; j<nNuc ; ++j ) {
-         d=MatrixVectorOperations3D::Distance(atom[i].x,atom[j].x);
-         vdwd=(atom[i].GetVDWRadius()+atom[j].GetVDWRadius());
-         if ( d<=vdwd ) {
-            bond[i].push_back(j);
-            bndDist[i].push_back(d);
-            if ( d>maxBondDist ) { maxBondDist=d; }
+         blkMaxD[blk]=maxd;
+         blkMinD2[blk]=mind2;
+      };
+      auto copyBonds=[&](size_t blk) {
+         size_t pos=0,n;
+         for ( int l=cellStart[blkCell[blk]] ; l<cellStart[blkCell[blk+1]] ; ++l ) {
+            int al=cellAtom[l];
+            n=bondStart[al+1]-bondStart[al];
+            std::copy(blkBond[blk].begin()+pos,blkBond[blk].begin()+pos+n,bond.begin()+bondStart[al]);
+            std::copy(blkDist[blk].begin()+pos,blkDist[blk].begin()+pos+n,bndDist.begin()+bondStart[al]);
+            pos+=n;
          }
-         if ( d<clsstatd ) {clsstatd=d;}
+         blkBond[blk].clear();
+         blkBond[blk].shrink_to_fit();
+         blkDist[blk].clear();
+         blkDist[blk].shrink_to_fit();
+      };
+      WorkStealingPool pool(nBlk>1 ? nthr : 1);
+      pool.ParallelFor(size_t(nBlk),findBonds);
+      for ( int i=0 ; i<nNuc ; ++i ) { bondStart[i+1]+=bondStart[i]; }
+      bond.resize(bondStart[nNuc]);
+      bndDist.resize(bondStart[nNuc]);
+      pool.ParallelFor(size_t(nBlk),copyBonds);
+      double mind2=1.0e+100;
+      for ( int b=0 ; b<nBlk ; ++b ) {
+         if ( blkMaxD[b]>maxBondDist ) { maxBondDist=blkMaxD[b]; }
+         if ( blkMinD2[b]<mind2 ) { mind2=blkMinD2[b]; }
       }
+      if ( mind2<1.0e+100 ) { clsstatd=sqrt(mind2); }
    }
-   // */
    if (nNuc==1) {maxBondDist=3.0e0;}
    if (maxBondDist<0.0e0) {
       if ( nNuc==2 ) {
-         maxBondDist=MatrixVectorOperations3D::Distance(atom[0].x,atom[1].x);
+         maxBondDist=AtomDistance(0,1);
       } else {
          maxBondDist=clsstatd;
       }
    }
 }
 void Molecule::SetupCells() {
+   cellStart.clear();
+   cellAtom.clear();
+   for ( size_t i=0 ; i<3 ; ++i ) { nCell[i]=0; }
+   cellListOk=true;
+   const size_t nNuc=atom.size();
+   if ( nNuc==0 ) { return; }
    DetermineBoundingBox();
-   double len[3],lmin[3],lmax[3];
-   for ( size_t i=0 ; i<3 ; ++i ) { lmin[i]=xmin[i]-cellLen; }
-   for ( size_t i=0 ; i<3 ; ++i ) { lmax[i]=xmax[i]+cellLen; }
-   cout << "xmn: " << xmin[0] << ' ' << xmin[1] << ' ' << xmin[2] << '\n';
-   cout << "lmn: " << lmin[0] << ' ' << lmin[1] << ' ' << lmin[2] << '\n';
-   cout << "xmx: " << xmax[0] << ' ' << xmax[1] << ' ' << xmax[2] << '\n';
-   cout << "lmx: " << lmax[0] << ' ' << lmax[1] << ' ' << lmax[2] << '\n';
-   for ( size_t i=0 ; i<3 ; ++i ) { len[i]=xmax[i]-xmin[i]; }
-   //cout << "actlen: " << len[0] << ' ' << len[1] << ' ' << len[2] << '\n';
-   //for ( size_t i=0 ; i<3 ; ++i ) { len[i]=lmax[i]-lmin[i]; }
-   cout << "len: " << len[0] << ' ' << len[1] << ' ' << len[2] << '\n';
-   int nax=ceil(len[0]/cellLen), nx=nax+3;
-   int nay=ceil(len[1]/cellLen), ny=nay+3;
-   int naz=ceil(len[2]/cellLen), nz=naz+3;
-   cout << "nc: " << nx << ' ' << ny << ' ' << nz << '\n';
-   cell.resize(nx);
-   for ( int i=0 ; i<nx ; ++i ) {
-      cell[i].resize(ny);
-      for ( int j=0 ; j<ny ; ++j ) {
-         cell[i][j].resize(nz);
-         for ( int k=0 ; k<nz ; ++k ) {
-            cell[i][j][k].reserve(8);
-         }
+   bool present[256];
+   for ( int z=0 ; z<256 ; ++z ) { present[z]=false; }
+   for ( size_t i=0 ; i<nNuc ; ++i ) { present[atom.AtomicNumber(i)]=true; }
+   double maxVdWr=0.0e0;
+   for ( int z=1 ; z<=MAXATNUMDEF ; ++z ) {
+      if ( present[z] && VdWRadius(z)>maxVdWr ) { maxVdWr=VdWRadius(z); }
+   }
+   cellLen=2.0e0*maxVdWr;
+   if ( !(cellLen>0.0e0) ) { cellLen=1.0e0; }
+   double len[3],nc[3],nTot;
+   for ( size_t i=0 ; i<3 ; ++i ) {
+      cellOrig[i]=xmin[i];
+      len[i]=xmax[i]-xmin[i];
+   }
+   const double maxCells=double(2*nNuc+1);
+   while ( true ) {
+      nTot=1.0e0;
+      for ( size_t i=0 ; i<3 ; ++i ) {
+         nc[i]=floor(len[i]/cellLen)+1.0e0;
+         nTot*=nc[i];
       }
+      if ( nTot<=maxCells ) { break; }
+      cellLen*=(1.0001e0*cbrt(nTot/maxCells));
+   }
+   for ( size_t i=0 ; i<3 ; ++i ) { nCell[i]=int(nc[i]); }
+   const int nCells=nCell[0]*nCell[1]*nCell[2];
+   /* Counting sort: cellStart[c+1] counts the atoms of the cell c, the
+    * prefix sum gives the offsets, and the atoms are then scattered in
+    * increasing order.  */
+   cellStart.assign(nCells+1,0);
+   vector<int> atCell(nNuc);
+   const double* x=atom.X();
+   const double* y=atom.Y();
+   const double* z=atom.Z();
+   for ( size_t i=0 ; i<nNuc ; ++i ) {
+      atCell[i]=CellIndex(CellCoordinate(x[i],0),CellCoordinate(y[i],1),CellCoordinate(z[i],2));
+      ++cellStart[atCell[i]+1];
    }
-   int px,py,pz;
-   //int mxx=-10,mxy=-10,mxz=-10;
-   //int mnx=1000,mny=1000,mnz=1000;
+   for ( int c=0 ; c<nCells ; ++c ) { cellStart[c+1]+=cellStart[c]; }
+   vector<int> pos(cellStart.begin(),cellStart.end()-1);
+   cellAtom.resize(nNuc);
+   for ( size_t i=0 ; i<nNuc ; ++i ) { cellAtom[pos[atCell[i]]++]=int(i); }
+}
+void Molecule::Translate(const double dx,const double dy,const double dz) {
+   double* x=atom.X();
+   double* y=atom.Y();
+   double* z=atom.Z();
+   cellListOk=false;
    for ( size_t i=0 ; i<atom.size() ; ++i ) {
-      px=floor(double(nax)*(atom[i].x[0]-xmin[0])/len[0])+1;
-      py=floor(double(nay)*(atom[i].x[1]-xmin[1])/len[1])+1;
-      pz=floor(double(naz)*(atom[i].x[2]-xmin[2])/len[2])+1;
-      if ( px>=(nx-1) || 1>nx ) { cout << "Error!" << px << '\n'; continue; }
-      if ( py>=(ny-1) || 1>ny ) { cout << "Error!" << py << '\n'; continue; }
-      if ( pz>=(nz-1) || 1>nz ) { cout << "Error!" << pz << '\n'; continue; }
-      cell[px][py][pz].push_back(int(i));
-      //if ( px > mxx ) { mxx=px; }
-      //if ( py > mxy ) { mxy=py; }
-      //if ( pz > mxz ) { mxz=pz; }
-      //if ( px < mnx ) { mnx=px; }
-      //if ( py < mny ) { mny=py; }
-      //if ( pz < mnz ) { mnz=pz; }
+      x[i]+=dx;
+      y[i]+=dy;
+      z[i]+=dz;
    }
-   //cout << "minpos: " << mnx << ' ' << mny << ' ' << mnz << '\n';
-   //cout << "maxpos: " << mxx << ' ' << mxy << ' ' << mxz << '\n';
+}
+double Molecule::AtomDistance(const Molecule &m1,const size_t i,const Molecule &m2,const size_t j) {
+   double dx=m1.atom.X()[i]-m2.atom.X()[j];
+   double dy=m1.atom.Y()[i]-m2.atom.Y()[j];
+   double dz=m1.atom.Z()[i]-m2.atom.Z()[j];
+   double sum=0.0e0;
+   sum+=(dx*dx);
+   sum+=(dy*dy);
+   sum+=(dz*dz);
+   return sqrt(sum);
 }
 vector<size_t> Molecule::ListOfNeighbours(const size_t atpos) {
    vector<size_t> res(0);
@@ -419,22 +470,88 @@ vector<size_t> Molecule::ListOfNeighbours(const size_t atpos) {
       res.clear();
       return res;
    }
+   if ( !cellListOk ) { SetupCells(); }
    res.push_back(atpos);
-   double dx2;
-   double refVdWr=atom[atpos].GetVDWRadius();
-   double x0[3],x1[3];
-   x0[0]=atom[atpos].x[0]; x0[1]=atom[atpos].x[1]; x0[2]=atom[atpos].x[2];
-   double dVdWr;
-   for ( size_t i=0 ; i<atom.size() ; ++i ) {
-      if ( atpos==i ) { continue; }
-      dVdWr=refVdWr+atom[i].GetVDWRadius();
-      dVdWr*=dVdWr;
-      x1[0]=atom[i].x[0]; x1[1]=atom[i].x[1]; x1[2]=atom[i].x[2];
-      dx2=(x1[0]-x0[0])*(x1[0]-x0[0])+(x1[1]-x0[1])*(x1[1]-x0[1])+(x1[2]-x0[2])*(x1[2]-x0[2]);
-      if ( dx2<=dVdWr ) { res.push_back(i); }
+   AppendNeighbours(atpos,res);
+   std::sort(res.begin()+1,res.end());
+   return res;
+}
+void Molecule::ListOfNeighboursOfAllAtoms(vector<size_t> &start,vector<size_t> &nbr) {
+   const size_t nNuc=atom.size();
+   start.assign(nNuc+1,0);
+   nbr.clear();
+   if ( nNuc==0 ) { return; }
+   if ( !cellListOk ) { SetupCells(); }
+   nbr.reserve(4*nNuc);
+   for ( size_t i=0 ; i<nNuc ; ++i ) {
+      AppendNeighbours(i,nbr);
+      std::sort(nbr.begin()+start[i],nbr.end());
+      start[i+1]=nbr.size();
    }
+}
+vector<size_t> Molecule::AtomsWithinRadius(const vector<double> &x0,const double r) {
+   vector<size_t> res(0);
+   if ( atom.size()==0 || r<0.0e0 ) { return res; }
+   if ( !cellListOk ) { SetupCells(); }
+   int lo[3],hi[3];
+   for ( size_t k=0 ; k<3 ; ++k ) {
+      lo[k]=CellCoordinate(x0[k]-r,k);
+      hi[k]=CellCoordinate(x0[k]+r,k);
+   }
+   const double* x=atom.X();
+   const double* y=atom.Y();
+   const double* z=atom.Z();
+   const double r2=r*r;
+   double dx,dy,dz;
+   int c;
+   size_t j;
+   for ( int p=lo[0] ; p<=hi[0] ; ++p ) {
+      for ( int q=lo[1] ; q<=hi[1] ; ++q ) {
+         for ( int s=lo[2] ; s<=hi[2] ; ++s ) {
+            c=CellIndex(p,q,s);
+            for ( int l=cellStart[c] ; l<cellStart[c+1] ; ++l ) {
+               j=size_t(cellAtom[l]);
+               dx=x[j]-x0[0];
+               dy=y[j]-x0[1];
+               dz=z[j]-x0[2];
+               if ( (dx*dx+dy*dy+dz*dz)<=r2 ) { res.push_back(j); }
+            }
+         }
+      }
+   }
+   std::sort(res.begin(),res.end());
    return res;
 }
+void Molecule::AppendNeighbours(const size_t atpos,vector<size_t> &nbr) const {
+   const double* x=atom.X();
+   const double* y=atom.Y();
+   const double* z=atom.Z();
+   const double refVdWr=VdWRadius(atom.AtomicNumber(atpos));
+   const double x0[3]={x[atpos],y[atpos],z[atpos]};
+   int ci[3];
+   for ( size_t k=0 ; k<3 ; ++k ) { ci[k]=CellCoordinate(x0[k],k); }
+   double dx2,dVdWr;
+   int c;
+   size_t j;
+   for ( int p=ci[0]-1 ; p<=ci[0]+1 ; ++p ) {
+      if ( p<0 || p>=nCell[0] ) { continue; }
+      for ( int q=ci[1]-1 ; q<=ci[1]+1 ; ++q ) {
+         if ( q<0 || q>=nCell[1] ) { continue; }
+         for ( int s=ci[2]-1 ; s<=ci[2]+1 ; ++s ) {
+            if ( s<0 || s>=nCell[2] ) { continue; }
+            c=CellIndex(p,q,s);
+            for ( int l=cellStart[c] ; l<cellStart[c+1] ; ++l ) {
+               j=size_t(cellAtom[l]);
+               if ( j==atpos ) { continue; }
+               dVdWr=refVdWr+VdWRadius(atom.AtomicNumber(j));
+               dVdWr*=dVdWr;
+               dx2=(x[j]-x0[0])*(x[j]-x0[0])+(y[j]-x0[1])*(y[j]-x0[1])+(z[j]-x0[2])*(z[j]-x0[2]);
+               if ( dx2<=dVdWr ) { nbr.push_back(j); }
+            }
+         }
+      }
+   }
+}
 std::ostream &operator<<(std::ostream &out,const Molecule (&mol)) {
    if ( !mol.ImSetup() ) { return out; }
    out << "The molecule has " << mol.Size() << " atoms." << endl;
@@ -450,43 +567,66 @@ std::ostream &operator<<(std::ostream &out,const Molecule* mol) {
    out << *mol;
    return out;
 }
-bool operator== (const Molecule &m1, const Molecule &m2) {
-   size_t n1=m1.Size();
-   if ( n1!=m2.Size() ) { return false; }
-   bool tmpbool;
-   vector<double> tmpvec;
-   double d;
-   int nat;
-   for ( size_t i=0 ; i<n1 ; ++i ) {
-      tmpvec=m1.atom[i].x;
-      tmpbool=false;
-      nat=m1.atom[i].num;
-      for ( size_t j=0 ; j<n1 ; ++j ) {
-         d=MatrixVectorOperations3D::Distance(tmpvec,m2.atom[j].x);
-         if ( d<COORDSEPSILON && (nat==m2.atom[j].num) ) {
-            tmpbool=true;
-            break;
-         }
-      }
-      if ( !tmpbool ) { return false; }
+/** Checks that every atom of m1 is found in h (the hash of a molecule with
+ * as many atoms as m1).  */
+static bool AllAtomsFound(const Molecule &m1,const AtomSpatialHash &h) {
+   vector<int> found;
+   found.reserve(4);
+   double x0[3];
+   for ( size_t i=0 ; i<m1.Size() ; ++i ) {
+      x0[0]=m1.atom.X()[i]; x0[1]=m1.atom.Y()[i]; x0[2]=m1.atom.Z()[i];
+      found.clear();
+      if ( h.FindAtoms(x0,m1.atom.AtomicNumber(i),found)==0 ) { return false; }
    }
    return true;
 }
+bool operator== (const Molecule &m1, const Molecule &m2) {
+   if ( m1.Size()!=m2.Size() ) { return false; }
+   AtomSpatialHash h(m2);
+   return AllAtomsFound(m1,h);
+}
 void DuplicateAtomOrder(Molecule &m1,Molecule &m2) {
    size_t n1=m1.Size();
-   vector<double> tmpvec;
-   double d;
-   int nat;
-   for ( size_t i=0 ; i<n1 ; ++i ) {
-      tmpvec=m1.atom[i].x;
-      nat=m1.atom[i].num;
-      for ( size_t j=0 ; j<n1 ; ++j ) {
-         d=MatrixVectorOperations3D::Distance(tmpvec,m2.atom[j].x);
-         if ( d<COORDSEPSILON && (nat==m2.atom[j].num) ) {
-            std::swap(m2.atom[i],m2.atom[j]);
-            break;
-         }
+   m2.InvalidateCellList();
+   /* The hash identifies the atoms of m2 by their initial index; pos[a] is
+    * the current position of the atom a, and at[p] the atom at position p.  */
+   AtomSpatialHash h(m2);
+   const size_t n2=m2.Size();
+   vector<size_t> pos(n2),at(n2);
+   for ( size_t a=0 ; a<n2 ; ++a ) { pos[a]=at[a]=a; }
+   vector<int> found;
+   found.reserve(4);
+   double x0[3];
+   size_t j;
+   for ( size_t i=0 ; i<n1 && i<n2 ; ++i ) {
+      x0[0]=m1.atom.X()[i]; x0[1]=m1.atom.Y()[i]; x0[2]=m1.atom.Z()[i];
+      found.clear();
+      h.FindAtoms(x0,m1.atom.AtomicNumber(i),found);
+      j=n1;
+      for ( size_t l=0 ; l<found.size() ; ++l ) {
+         if ( pos[found[l]]<j ) { j=pos[found[l]]; }
       }
+      if ( j==n1 ) { continue; }
+      m2.atom.Swap(i,j);
+      std::swap(at[i],at[j]);
+      pos[at[i]]=i;
+      pos[at[j]]=j;
    }
 }
-
+void CompareWithFrames(const Molecule &ref,const vector<shared_ptr<Molecule> > &frames,\
+      vector<bool> &res,const size_t nthr) {
+   AtomSpatialHash h(ref);
+   vector<char> eq(frames.size(),0);
+   WorkStealingPool pool(nthr);
+   pool.ParallelFor(frames.size(),[&](size_t f) {
+      if ( frames[f] && frames[f]->Size()==ref.Size() ) { eq[f]=AllAtomsFound(*(frames[f]),h); }
+   });
+   res.assign(eq.begin(),eq.end());
+}
+void DuplicateAtomOrderInFrames(Molecule &ref,vector<shared_ptr<Molecule> > &frames,\
+      const size_t nthr) {
+   WorkStealingPool pool(nthr);
+   pool.ParallelFor(frames.size(),[&](size_t f) {
+      if ( frames[f] ) { DuplicateAtomOrder(ref,*(frames[f])); }
+   });
+}
@@ -45,11 +45,19 @@
 using std::vector;
 #include <string>
 using std::string;
+#include <cmath>
+#include <memory>
+using std::shared_ptr;
 #include "atom.h"
+#include "atomarray.h"
 
 #ifndef SINGLECOORDEPS
 #define SINGLECOORDEPS 1.0e-04
 #endif
+/** Approximate number of atoms per task in Molecule::SetupBonds.  */
+#ifndef MOLECULEBONDBLOCKSIZE
+#define MOLECULEBONDBLOCKSIZE 8192
+#endif
 
 /* ************************************************************************** */
 class Molecule {
@@ -82,30 +90,94 @@ public:
    /** Sets the center of the coordinate system as in the original reading/loading
     * (the molecule is translated to origCent).  */
    void ResetOriginOfCoordinates();
-   void SetupBonds();
+   /** Translates all the atoms by (dx,dy,dz).  */
+   void Translate(const double dx,const double dy,const double dz);
+   /** Distance between the atom i of m1 and the atom j of m2.  */
+   static double AtomDistance(const Molecule &m1,const size_t i,const Molecule &m2,const size_t j);
+   /** Distance between the atoms i and j.  */
+   double AtomDistance(const size_t i,const size_t j) const { return AtomDistance(*this,i,*this,j); }
+   /** Finds the bonds (two atoms are bonded if their distance is not larger
+    * than the sum of their VdW radii). The search uses the cell list
+    * (see SetupCells), and the cells are distributed among nthr threads
+    * (nthr=0 means all the hardware threads). The result does not depend
+    * on the number of threads.  */
+   void SetupBonds(const size_t nthr=0);
+   /** Sorts the atoms into a uniform grid of cubic cells (counting sort).
+    * The side of the cells (cellLen) is the largest sum of VdW radii of the
+    * elements present in the molecule, hence two bonded atoms are in the
+    * same or in adjacent cells. The side is increased if the grid would
+    * have more than 2n+1 cells. The cell list is kept (and reused by the
+    * neighbour queries) until the coordinates change.  */
    void SetupCells();
+   /** Discards the cell list. The member functions that move or reorder the
+    * atoms call it; it must also be called after changing the coordinates
+    * directly through atom.  */
+   void InvalidateCellList() { cellListOk=false; }
+   /** Returns the index of the cell (i,j,k) in cellStart.  */
+   int CellIndex(const int i,const int j,const int k) const {
+      return (i*nCell[1]+j)*nCell[2]+k;
+   }
    void DisplayBondProperties();
    /** Returns a vector of indices. The first element of the vector
     * is the observed atom, and the following elements are the indices of
-    * the observed atom neighbours.  */
+    * the observed atom neighbours (in increasing order). Two atoms are
+    * neighbours if their distance is not larger than the sum of their
+    * VdW radii.  */
    vector<size_t> ListOfNeighbours(const size_t atpos);
+   /** Computes the neighbours of every atom, in compressed sparse row form:
+    * the neighbours of the atom i are nbr[k], for k=start[i],...,(start[i+1]-1),
+    * in increasing order. The number of neighbours of the atom i is
+    * (start[i+1]-start[i]).  */
+   void ListOfNeighboursOfAllAtoms(vector<size_t> &start,vector<size_t> &nbr);
+   /** Returns the indices (in increasing order) of the atoms whose distance
+    * to the point x0 is not larger than r.  */
+   vector<size_t> AtomsWithinRadius(const vector<double> &x0,const double r);
 /* ************************************************************************** */
-   vector<Atom> atom;
+   /** The atoms (structure of arrays; see AtomArray).  */
+   AtomArray atom;
    vector<double> cm; /*!< Center of mass  */
    vector<double> cd; /*!< Centroid  */
    vector<double> xmin; /** Lower, back, left bounding box.  */
    vector<double> xmax; /** Upper, front, right bounding box. */
    double rmax; /*!< Holds the maximum atom distance from the center of mass.  */
-   vector<vector<int> > bond;
-   vector<vector<double> > bndDist;
+   /** Bonds, in compressed sparse row form. The atoms bonded to the atom i
+    * whose indices are larger than i are bond[k], for
+    * k=bondStart[i],...,(bondStart[i+1]-1), in increasing order; bndDist[k]
+    * is the corresponding distance.  */
+   vector<size_t> bondStart;
+   vector<int> bond;
+   vector<double> bndDist;
    double maxBondDist;
-   vector<vector<vector<vector<int > > > > cell;
-   static double constexpr cellLen=5.0e0;
+   /** Cell list. The atoms of the cell c are cellAtom[k], for
+    * k=cellStart[c],...,(cellStart[c+1]-1), in increasing order. The cell
+    * (i,j,k) (see CellIndex) spans [cellOrig+cellLen*(i,j,k),
+    * cellOrig+cellLen*(i+1,j+1,k+1)).  */
+   vector<int> cellStart;
+   vector<int> cellAtom;
+   int nCell[3];
+   double cellOrig[3];
+   double cellLen;
    bool ImSetup() const;
 /* ************************************************************************** */
 protected:
 /* ************************************************************************** */
    void Init();
+   /** Index, along the axis k, of the cell that contains the coordinate xk
+    * (points outside of the grid are assigned to the border cells).  */
+   int CellCoordinate(const double xk,const size_t k) const {
+      double t=floor((xk-cellOrig[k])/cellLen);
+      if ( !(t>=0.0e0) ) { return 0; }
+      if ( t>=double(nCell[k]) ) { return nCell[k]-1; }
+      return int(t);
+   }
+   /** VdW radius of the atomic number z, or zero if z is not known.  */
+   static double VdWRadius(const int z) {
+      return ( z<1 || z>MAXATNUMDEF ) ? 0.0e0 : Atom::GetVDWRadius(z);
+   }
+   /** Appends to nbr the neighbours of the atom atpos (in the order of the
+    * cell list, which must be up to date).  */
+   void AppendNeighbours(const size_t atpos,vector<size_t> &nbr) const;
+   bool cellListOk;
    void QuickSort(int srtIdx) {return QuickSort((atom.size()-1),0,srtIdx);}
    void QuickSort(int high, int low,int srtIdx=0);
    bool imsetup;
@@ -117,8 +189,23 @@ protected:
 /* ************************************************************************** */
 std::ostream &operator<<(std::ostream &out,const Molecule (&mol));
 std::ostream &operator<<(std::ostream &out,const Molecule* mol);
+/** Returns true if both molecules have the same number of atoms, and every
+ * atom of m1 has an atom of m2 of the same element closer than COORDSEPSILON
+ * (see AtomSpatialHash).  */
 bool operator== (const Molecule &m1, const Molecule &m2);
+/** Reorders the atoms of m2, so that the i-th atom of m2 is the atom of the
+ * same element closer than COORDSEPSILON to the i-th atom of m1 (the first
+ * one, in the current order of m2, if there are several).  */
 void DuplicateAtomOrder(Molecule &m1,Molecule &m2);
+/** Batch version of operator==: res[f] is (*(frames[f])==ref). A single
+ * spatial hash of ref is shared by all the frames, which are distributed
+ * among nthr threads (nthr=0 means all the hardware threads).  */
+void CompareWithFrames(const Molecule &ref,const vector<shared_ptr<Molecule> > &frames,\
+      vector<bool> &res,const size_t nthr=0);
+/** Batch version of DuplicateAtomOrder: reorders the atoms of every frame
+ * as in DuplicateAtomOrder(ref,*(frames[f])), using nthr threads.  */
+void DuplicateAtomOrderInFrames(Molecule &ref,vector<shared_ptr<Molecule> > &frames,\
+      const size_t nthr=0);
 
 #endif  /* _MOLECULE_H_ */
 
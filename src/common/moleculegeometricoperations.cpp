@@ -51,11 +51,27 @@ using std::cerr;
 MatrixVectorOperations3D MoleculeGeometricOperations::mop;
 void MoleculeGeometricOperations::AlignFirstMomentOfInertiaToZ(shared_ptr<Molecule> &mol,\
       shared_ptr<MoleculeInertiaTensor> &I) {
-   vector<double> v2=I->Eve(2),tmp;
+   vector<double> v2=I->Eve(2);
    vector<vector<double> > m=MatrixVectorOperations3D::GetMatrixToAlignVToZ(v2);
+   TransformCoordinates(mol,m);
+}
+void MoleculeGeometricOperations::TransformCoordinates(shared_ptr<Molecule> &mol,\
+      const vector<vector<double> > &m) {
+   double* x=mol->atom.X();
+   double* y=mol->atom.Y();
+   double* z=mol->atom.Z();
+   double xi,yi,zi,r[3];
+   mol->InvalidateCellList();
    for ( size_t i=0 ; i<mol->Size() ; ++i ) {
-      tmp=mol->atom[i].x;
-      mol->atom[i].x=MatrixVectorOperations3D::MatrixVectorProduct(m,tmp);
+      xi=x[i]; yi=y[i]; zi=z[i];
+      /* Same order of operations as MatrixVectorOperations3D::MatrixVectorProduct.  */
+      for ( size_t k=0 ; k<3 ; ++k ) {
+         r[k]=0.0e0;
+         r[k]+=(m[k][0]*xi);
+         r[k]+=(m[k][1]*yi);
+         r[k]+=(m[k][2]*zi);
+      }
+      x[i]=r[0]; y[i]=r[1]; z[i]=r[2];
    }
 }
 void MoleculeGeometricOperations::AlignSecondMomemtOfInertaiToY(shared_ptr<Molecule> &mol,\
@@ -67,9 +83,7 @@ void MoleculeGeometricOperations::AlignSecondMomemtOfInertaiToY(shared_ptr<Molec
    vector<double> z=MatrixVectorOperations3D::Z();
    vector<double> cross=MatrixVectorOperations3D::CrossProduct(y,I->Eve(1));
    if ( MatrixVectorOperations3D::InnerProduct(cross,z) < 0.0e0 ) { angle=-angle; }
-   for ( size_t i=0 ; i<mol->Size() ; ++i ) {
-      MatrixVectorOperations3D::RotateAroundZAxis(mol->atom[i].x,angle);
-   }
+   TransformCoordinates(mol,MatrixVectorOperations3D::GetRotationMatrixAroundZ(angle));
    /*
    //There is no garantee for the eigenvector to change its quirality if 
    //  the molecule is rotated pi rads around z!
@@ -99,7 +113,7 @@ double MoleculeGeometricOperations::RMSD(shared_ptr<Molecule> &m1,shared_ptr<Mol
    assert(m1->Size() == m2->Size());
    for ( size_t i=0 ; i<m1->Size() ; ++i ) {
       for ( size_t j=0 ; j<3 ; ++j ) {
-         tmp=(m1->atom[i].x[j])-(m2->atom[i].x[j]);
+         tmp=(m1->atom.Coordinate(j)[i])-(m2->atom.Coordinate(j)[i]);
          rmsd+=(tmp*tmp);
       }
    }
@@ -107,48 +121,37 @@ double MoleculeGeometricOperations::RMSD(shared_ptr<Molecule> &m1,shared_ptr<Mol
    return sqrt(rmsd);
 }
 void MoleculeGeometricOperations::Rotate90DegAroundZAndSort(shared_ptr<Molecule> &mol) {
-   for ( size_t i=0 ; i<mol->Size() ; ++i ) {
-      MatrixVectorOperations3D::RotateAroundZAxis(mol->atom[i].x,M_PI_2);
-   }
+   TransformCoordinates(mol,MatrixVectorOperations3D::GetRotationMatrixAroundZ(M_PI_2));
    mol->SortCoordinates();
    //cout << *mol << endl;
 }
 void MoleculeGeometricOperations::Rotate180DegAroundYAndSort(shared_ptr<Molecule> &mol) {
-   for ( size_t i=0 ; i<mol->Size() ; ++i ) {
-      MatrixVectorOperations3D::RotateAroundYAxis(mol->atom[i].x,M_PI);
-   }
+   TransformCoordinates(mol,MatrixVectorOperations3D::GetRotationMatrixAroundY(M_PI));
    mol->SortCoordinates();
    //cout << *mol << endl;
 }
 void MoleculeGeometricOperations::Rotate90DegAroundYAndSort(shared_ptr<Molecule> &mol) {
-   for ( size_t i=0 ; i<mol->Size() ; ++i ) {
-      MatrixVectorOperations3D::RotateAroundYAxis(mol->atom[i].x,M_PI_2);
-   }
+   TransformCoordinates(mol,MatrixVectorOperations3D::GetRotationMatrixAroundY(M_PI_2));
    mol->SortCoordinates();
    //cout << *mol << endl;
 }
 void MoleculeGeometricOperations::Rotate90DegAroundXAndSort(shared_ptr<Molecule> &mol) {
-   for ( size_t i=0 ; i<mol->Size() ; ++i ) {
-      MatrixVectorOperations3D::RotateAroundXAxis(mol->atom[i].x,M_PI_2);
-   }
+   TransformCoordinates(mol,MatrixVectorOperations3D::GetRotationMatrixAroundX(M_PI_2));
    mol->SortCoordinates();
    //cout << *mol << endl;
 }
 void MoleculeGeometricOperations::InvertCoordinates(shared_ptr<Molecule> &mol) {
-   for ( size_t i=0 ; i<mol->Size() ; ++i ) {
-      for ( size_t j=0 ; j<3 ; ++j ) { mol->atom[i].x[j]=-mol->atom[i].x[j]; }
-      //mol->atom[i].x[0]=-mol->atom[i].x[0];
+   mol->InvalidateCellList();
+   for ( size_t j=0 ; j<3 ; ++j ) {
+      double* x=mol->atom.Coordinate(j);
+      for ( size_t i=0 ; i<mol->Size() ; ++i ) { x[i]=-x[i]; }
    }
    mol->SortCoordinates();
    //cout << *mol << endl;
 }
 void MoleculeGeometricOperations::RotateWithRotationMatrix(shared_ptr<Molecule> &mol,\
       vector<vector<double> > &RR) {
-   vector<double> tmp(3);
-   for ( size_t i=0 ; i<mol->Size() ; ++i ) {
-      tmp=mol->atom[i].x;
-      mol->atom[i].x=MatrixVectorOperations3D::MatrixVectorProduct(RR,tmp);
-   }
+   TransformCoordinates(mol,RR);
 }
 void MoleculeGeometricOperations::RotateUsingEulerAngles(shared_ptr<Molecule> &mol,\
       const double alpha,const double beta,const double gamma) {
@@ -166,9 +169,7 @@ void MoleculeGeometricOperations::TranslateCoordinates(shared_ptr<Molecule> &mol
       cout << __FILE__ << ", line: " << __LINE__ << endl;
       return;
    }
-   for ( size_t i=0 ; i<mol->Size() ; ++i ) {
-      for ( size_t j=0 ; j<3 ; ++j ) { mol->atom[i].x[j]+=a[j]; }
-   }
+   mol->Translate(a[0],a[1],a[2]);
 }
 void MoleculeGeometricOperations::TranslateCoordinates(shared_ptr<Molecule> &mol) {
    vector<double> a=mop.RandomVector();
@@ -101,6 +101,8 @@ public:
    static void RotateUsingEulerAngles(shared_ptr<Molecule> &mol);
    static void TranslateCoordinates(shared_ptr<Molecule> &mol,const vector<double> &a);
    static void TranslateCoordinates(shared_ptr<Molecule> &mol);
+   /** Replaces the coordinates x of every atom by m.x (m is 3x3).  */
+   static void TransformCoordinates(shared_ptr<Molecule> &mol,const vector<vector<double> > &m);
 /* ************************************************************************** */
 protected:
 /* ************************************************************************** */
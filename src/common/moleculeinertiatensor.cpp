@@ -93,22 +93,23 @@ void MoleculeInertiaTensor::Setup() {
 void MoleculeInertiaTensor::ComputeTotalMass() {
    totalMass=0.0e0;
    int nn=molecule->Size();
-   for ( int i=0 ; i<nn ; ++i ) { totalMass+=molecule->atom[i].weight; }
+   for ( int i=0 ; i<nn ; ++i ) { totalMass+=Atom::GetAtomicWeight(molecule->atom.AtomicNumber(i)); }
 }
 void MoleculeInertiaTensor::CenterMolecule() {
    for ( int i=0 ; i<3 ; ++i ) { initCentOfMass[i]=0.0e0; }
    int nn=molecule->Size();
+   const double* x=molecule->atom.X();
+   const double* y=molecule->atom.Y();
+   const double* z=molecule->atom.Z();
+   double m;
    for ( int i=0 ; i<nn ; ++i ) {
-      for ( int j=0 ; j<3 ; ++j ) {
-         initCentOfMass[j]+=((molecule->atom[i].weight)*(molecule->atom[i].x[j]));
-      }
+      m=Atom::GetAtomicWeight(molecule->atom.AtomicNumber(i));
+      initCentOfMass[0]+=(m*x[i]);
+      initCentOfMass[1]+=(m*y[i]);
+      initCentOfMass[2]+=(m*z[i]);
    }
    for ( int i=0 ; i<3 ; ++i ) { initCentOfMass[i]/=totalMass; }
-   for ( int i=0 ; i<nn ; ++i ) {
-      for ( int j=0 ; j<3 ; ++j ) {
-         (molecule->atom[i].x[j])-=(initCentOfMass[j]);
-      }
-   }
+   molecule->Translate(-initCentOfMass[0],-initCentOfMass[1],-initCentOfMass[2]);
 }
 void MoleculeInertiaTensor::ComputeInertiaTensor() {
    for ( int i=0 ; i<3 ; ++i ) {
@@ -116,11 +117,14 @@ void MoleculeInertiaTensor::ComputeInertiaTensor() {
    }
    int nn=molecule->Size();
    double m,x,y,z;
+   const double* px=molecule->atom.X();
+   const double* py=molecule->atom.Y();
+   const double* pz=molecule->atom.Z();
    for ( int i=0 ; i<nn ; ++i ) {
-      m=molecule->atom[i].weight;
-      x=molecule->atom[i].x[0];
-      y=molecule->atom[i].x[1];
-      z=molecule->atom[i].x[2];
+      m=Atom::GetAtomicWeight(molecule->atom.AtomicNumber(i));
+      x=px[i];
+      y=py[i];
+      z=pz[i];
       data[0][0]+=(m*(y*y+z*z));
       data[1][1]+=(m*(x*x+z*z));
       data[2][2]+=(m*(x*x+y*y));
@@ -44,8 +44,11 @@
 using std::cout;
 using std::endl;
 using std::cerr;
+#include <cstring>
+#include <cctype>
 #include "stringtools.h"
 #include "myparser.h"
+#include "mappedfile.h"
 
 
 bool MyParser::Read(string fname,string key,double &var){
@@ -75,6 +78,14 @@ bool MyParser::Read(string fname,string key,vector<double> &vec){
    ifil.close();
    return true;
 }
+bool MyParser::Read(string fname,string key,string &str){
+   ifstream ifil(fname.c_str());
+   size_t pos=GetPosAfterKeyword(ifil,key,false);
+   if ( pos==string::npos ) { return false; } //The file did not contain the key!
+   ifil >> str;
+   ifil.close();
+   return true;
+}
 size_t MyParser::GetPosAfterKeyword(const string fname,const string key) {
    ifstream ifil(fname.c_str());
    size_t pos=GetPosAfterKeyword(ifil,key,false);
@@ -94,4 +105,110 @@ size_t MyParser::GetPosAfterKeyword(ifstream &ifil,const string key,bool rewind)
    if ( ifil.eof() ) { pos=string::npos; }
    return pos;
 }
+MyParser::Index::Index() {
+   imsetup=false;
+}
+MyParser::Index::Index(const string &fname) : Index() {
+   imsetup=Open(fname);
+}
+bool MyParser::Index::Open(const string &fname) {
+   keys.clear();
+   content.clear();
+   imsetup=false;
+   MappedFile mf(fname);
+   if ( !mf.IsOpen() ) { return false; }
+   content.assign(mf.Data(),mf.Size());
+   mf.Close();
+   const char* beg=content.c_str();
+   const char* end=beg+content.size();
+   const char* p=beg;
+   const char* lb;
+   const char* le;
+   const char* nl;
+   while ( p<end ) {
+      nl=static_cast<const char*>(std::memchr(p,'\n',size_t(end-p)));
+      if ( nl==nullptr ) { break; } //As GetPosAfterKeyword: the last line needs a newline.
+      lb=p;
+      le=nl;
+      while ( (lb<le) && (*lb==' ' || *lb=='\t' || *lb=='\r') ) { ++lb; }
+      while ( (le>lb) && (le[-1]==' ' || le[-1]=='\t' || le[-1]=='\r') ) { --le; }
+      if ( le>lb ) {
+         keys[string(lb,le-lb)].push_back(std::make_pair(size_t(p-beg),size_t(nl+1-beg)));
+      }
+      p=nl+1;
+   }
+   imsetup=true;
+   return true;
+}
+size_t MyParser::Index::Count(const string &key) const {
+   std::unordered_map<string,vector<std::pair<size_t,size_t> > >::const_iterator it=keys.find(key);
+   return ( it==keys.end() ? 0 : it->second.size() );
+}
+size_t MyParser::Index::GetPosOfKeyword(const string &key,size_t occ) const {
+   std::unordered_map<string,vector<std::pair<size_t,size_t> > >::const_iterator it=keys.find(key);
+   if ( it==keys.end() || occ>=it->second.size() ) { return string::npos; }
+   return it->second[occ].first;
+}
+size_t MyParser::Index::GetValuePos(const string &key,size_t occ) const {
+   std::unordered_map<string,vector<std::pair<size_t,size_t> > >::const_iterator it=keys.find(key);
+   if ( it==keys.end() || occ>=it->second.size() ) { return string::npos; }
+   return it->second[occ].second;
+}
+bool MyParser::Index::Read(const string &key,double &var,size_t occ) const {
+   size_t pos=GetValuePos(key,occ);
+   if ( pos==string::npos ) { return false; }
+   /* content is null-terminated, hence strtod can work in place.  */
+   char* endp;
+   double v=std::strtod(content.c_str()+pos,&endp);
+   if ( endp==content.c_str()+pos ) { return false; }
+   var=v;
+   return true;
+}
+bool MyParser::Index::Read(const string &key,int &var,size_t occ) const {
+   size_t pos=GetValuePos(key,occ);
+   if ( pos==string::npos ) { return false; }
+   char* endp;
+   long v=std::strtol(content.c_str()+pos,&endp,10);
+   if ( endp==content.c_str()+pos ) { return false; }
+   var=int(v);
+   return true;
+}
+bool MyParser::Index::Read(const string &key,vector<double> &vec,size_t occ) const {
+   size_t pos=GetValuePos(key,occ);
+   if ( pos==string::npos ) { return false; }
+   const char* p=content.c_str()+pos;
+   char* endp;
+   long n=std::strtol(p,&endp,10);
+   if ( endp==p || n<0 ) { return false; }
+   vec.resize(size_t(n));
+   for ( long i=0 ; i<n ; ++i ) {
+      p=endp;
+      vec[i]=std::strtod(p,&endp);
+      if ( endp==p ) { vec.resize(size_t(i)); return false; }
+   }
+   return true;
+}
+bool MyParser::Index::Read(const string &key,double* vals,const size_t n,size_t occ) const {
+   size_t pos=GetValuePos(key,occ);
+   if ( pos==string::npos ) { return false; }
+   const char* p=content.c_str()+pos;
+   char* endp;
+   for ( size_t i=0 ; i<n ; ++i ) {
+      vals[i]=std::strtod(p,&endp);
+      if ( endp==p ) { return false; }
+      p=endp;
+   }
+   return true;
+}
+bool MyParser::Index::Read(const string &key,string &str,size_t occ) const {
+   size_t pos=GetValuePos(key,occ);
+   if ( pos==string::npos ) { return false; }
+   const char* p=content.c_str()+pos;
+   while ( (*p)!='\0' && std::isspace(static_cast<unsigned char>(*p)) ) { ++p; }
+   const char* q=p;
+   while ( (*q)!='\0' && !std::isspace(static_cast<unsigned char>(*q)) ) { ++q; }
+   if ( q==p ) { return false; }
+   str.assign(p,q-p);
+   return true;
+}
 
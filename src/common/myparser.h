@@ -47,6 +47,7 @@ using std::string;
 using std::ifstream;
 #include <vector>
 using std::vector;
+#include <unordered_map>
 
 /* ************************************************************************** */
 /** This is a helper class that reads from a file. The names
@@ -79,6 +80,43 @@ public:
 /* ************************************************************************** */
    static size_t GetPosAfterKeyword(ifstream &ifil,const string key,bool rewind=false);
    static size_t GetPosAfterKeyword(const string fname,const string key);
+/* ************************************************************************** */
+   /** Reads a file once, and records the offsets of all its keywords (i.e.
+    * every non-empty line, without leading/trailing blanks, that is
+    * followed by a newline), so that several keys can be read without
+    * reopening and rescanning the file. A keyword may appear several times;
+    * its occurrences are kept in order (occ=0 is the first one, which is
+    * the one the static functions above read). The typed reads follow the
+    * conventions of the static Read functions.  */
+   class Index {
+   public:
+      Index();
+      explicit Index(const string &fname);
+      /** Returns false if the file could not be opened.  */
+      bool Open(const string &fname);
+      bool ImSetup() const { return imsetup; }
+      /** Number of occurrences of key.  */
+      size_t Count(const string &key) const;
+      /** Offset of the line that holds the occ-th occurrence of key (the
+       * same value GetPosAfterKeyword returns), or string::npos.  */
+      size_t GetPosOfKeyword(const string &key,size_t occ=0) const;
+      bool Read(const string &key,double &var,size_t occ=0) const;
+      bool Read(const string &key,int &var,size_t occ=0) const;
+      /** The first value is the number of elements, followed by the elements.  */
+      bool Read(const string &key,vector<double> &vec,size_t occ=0) const;
+      /** Reads exactly n values (there is no leading number of elements).  */
+      bool Read(const string &key,double* vals,const size_t n,size_t occ=0) const;
+      /** Reads the first word after the keyword.  */
+      bool Read(const string &key,string &str,size_t occ=0) const;
+   protected:
+      /** Returns the offset of the value(s), i.e. the beginning of the
+       * line that follows the keyword, or string::npos.  */
+      size_t GetValuePos(const string &key,size_t occ) const;
+      bool imsetup;
+      string content;
+      /** For each keyword, offsets of its lines and of the following ones.  */
+      std::unordered_map<string,vector<std::pair<size_t,size_t> > > keys;
+   };
 protected:
 /* ************************************************************************** */
 /* ************************************************************************** */
@@ -97,6 +97,7 @@ using std::string;
  * may occur.  */
 OptionFlagsBase::OptionFlagsBase() {
    inFileName=1;
+   outFileName=0;
    haveFigletName=false;
    figletName="";
    minArgs=2;
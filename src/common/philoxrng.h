@@ -0,0 +1,96 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _PHILOXRNG_H_
+#define _PHILOXRNG_H_
+#include <cstdint>
+#include <cmath>
+
+/* ************************************************************************** */
+/** Counter-based random number generator Philox4x32-10 (J. K. Salmon,
+ * M. A. Moraes, R. O. Dror, and D. E. Shaw, SC'11, 2011). The output is a
+ * pure function of a 128-bit counter and a 64-bit key (the seed); there is
+ * no state. Hence, the random numbers of a given sample (counter) do not
+ * depend on the order in which the samples are evaluated, nor on the number
+ * of threads that evaluate them.  */
+class PhiloxRNG {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   /** Computes the four 32-bit words out from the counter ctr and the
+    * key (seed).  */
+   static inline void Generate(const uint32_t (&ctr)[4],const uint64_t seed,uint32_t (&out)[4]) {
+      uint32_t c0=ctr[0],c1=ctr[1],c2=ctr[2],c3=ctr[3];
+      uint32_t k0=uint32_t(seed),k1=uint32_t(seed>>32);
+      uint64_t p0,p1;
+      for ( int r=0 ; r<10 ; ++r ) {
+         p0=uint64_t(0xD2511F53u)*c0;
+         p1=uint64_t(0xCD9E8D57u)*c2;
+         c0=uint32_t(p1>>32)^c1^k0;
+         c2=uint32_t(p0>>32)^c3^k1;
+         c1=uint32_t(p1);
+         c3=uint32_t(p0);
+         k0+=0x9E3779B9u;
+         k1+=0xBB67AE85u;
+      }
+      out[0]=c0; out[1]=c1; out[2]=c2; out[3]=c3;
+   }
+   /** Returns two independent standard normal deviates (Box-Muller), from
+    * the counter ctr and the key seed. Each uniform deviate uses 53 bits.  */
+   static inline void Normal2(const uint32_t (&ctr)[4],const uint64_t seed,double &z0,double &z1) {
+      uint32_t w[4];
+      Generate(ctr,seed,w);
+      const double two53=9007199254740992.0e0;
+      /* u1 lies in (0,1], so that log(u1) is finite.  */
+      double u1=(double((uint64_t(w[0])<<21)^(uint64_t(w[1])>>11))+1.0e0)/two53;
+      double u2=double((uint64_t(w[2])<<21)^(uint64_t(w[3])>>11))/two53;
+      double rr=sqrt(-2.0e0*log(u1));
+      double th=2.0e0*M_PI*u2;
+      z0=rr*cos(th);
+      z1=rr*sin(th);
+   }
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _PHILOXRNG_H_ */
+
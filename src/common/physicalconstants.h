@@ -52,6 +52,8 @@ public:
    static double constexpr kB=1.38064852e-23; // m^2 kg / ( s^2 K )
    static double constexpr NA=6.02214076e+23; // 1/mol
    static double constexpr h=6.62607015e-34; // J s
+   static double constexpr amu=1.66053906660e-27; // kg
+   static double constexpr atm=1.01325e+05; // Pa
 /* ************************************************************************** */
 protected:
 /* ************************************************************************** */
@@ -40,6 +40,8 @@
    README file.
 */
 #include <cstdlib>
+#include <cstring>
+#include <cctype>
 #include <iostream>
 using std::cout;
 using std::endl;
@@ -47,115 +49,338 @@ using std::cerr;
 #include <iomanip>
 using std::scientific;
 using std::setprecision;
-#include <fstream>
-using std::ifstream;
 #include <cmath>
 #include "screenutils.h"
 #include "rawg4sdata.h"
-#include "myparser.h"
+#include "mappedfile.h"
 #include "physicalconstants.h"
+#include "atom.h"
+#include <sstream>
+#include <map>
 
 RawG4sData::RawG4sData() {
    imsetup=false;
    islinear=true;
+   g4method=G4Method::UNKNOWN;
+   molecularMass=0.0e0;
+   rotSymmetryNumber=0;
 }
 RawG4sData::RawG4sData(const string &repname) : RawG4sData() {
    imsetup=Read(repname);
+   DisplayMessages();
    if ( !imsetup ) {
       ScreenUtils::DisplayErrorMessage(string("Data could not be loaded!"
                " while loading '")+repname+string("' file."));
       cout << __FILE__ << ", line: " << __LINE__ << endl;
    }
 }
+/* Keywords of the report (see WriteReport in G09LogExtractor, or the script
+ * g4-nitro-closed-xxx). The value(s) follow the line that holds the keyword.  */
+enum RawG4sDataKey {
+   RGK_ATOMS, RGK_ALPHA, RGK_BETA, RGK_METHOD, RGK_ISLINEAR, RGK_ZPE,
+   RGK_FREQS, RGK_MP2, RGK_MP4, RGK_CCSDT, RGK_HF, RGK_MASS, RGK_SYMNUM,
+   RGK_ROTCONST, RGK_NKEYS
+};
+struct RawG4sDataKeyword {
+   const char* key;
+   size_t len;
+   RawG4sDataKey id;
+};
+static const RawG4sDataKeyword rawG4sDataKeywords[RGK_NKEYS]={
+   {"ATOMS_IN_MOLECULE",17,RGK_ATOMS},
+   {"ALPHA_ELECTRONS",15,RGK_ALPHA},
+   {"BETA_ELECTRONS",14,RGK_BETA},
+   {"METHOD",6,RGK_METHOD},
+   {"IS_LINEAR",9,RGK_ISLINEAR},
+   {"ZeroPoint",9,RGK_ZPE},
+   {"FREQUENCIES",11,RGK_FREQS},
+   {"MP2",3,RGK_MP2},
+   {"MP4SDTQ",7,RGK_MP4},
+   {"CCSD(T)",7,RGK_CCSDT},
+   {"HF",2,RGK_HF},
+   {"MOLECULAR_MASS",14,RGK_MASS},
+   {"ROTATIONAL_SYMMETRY_NUMBER",26,RGK_SYMNUM},
+   {"ROTATIONAL_CONSTANTS_GHZ",24,RGK_ROTCONST}
+};
+/* The energies of the steps 3-8, in the order they appear in the report.  */
+struct RawG4sDataEnergySlot {
+   RawG4sDataKey id;
+   int step;
+   double RawG4sData::* member;
+   const char* label;
+};
+#define RAWG4SDATANSLOTS 11
+static const RawG4sDataEnergySlot rawG4sDataSlots[RAWG4SDATANSLOTS]={
+   {RGK_MP2,3,&RawG4sData::mp2gtbas1,"MP2 (Step3)"},
+   {RGK_MP4,3,&RawG4sData::mp4gtbas1,"MP4SDTQ (Step3)"},
+   {RGK_CCSDT,3,&RawG4sData::ccsdtg3bas1,"CCSD(T) (Step3)"},
+   {RGK_MP2,4,&RawG4sData::mp2gtbas2,"MP2 (Step4)"},
+   {RGK_MP4,4,&RawG4sData::mp4gtbas2,"MP4SDTQ (Step4)"},
+   {RGK_MP2,5,&RawG4sData::mp2gtbas3,"MP2 (Step5)"},
+   {RGK_MP4,5,&RawG4sData::mp4gtbas3,"MP4SDTQ (Step5)"},
+   {RGK_HF,6,&RawG4sData::hfgtlargexp,"HF (Step6)"},
+   {RGK_MP2,6,&RawG4sData::mp2gtlargexp,"MP2 (Step6)"},
+   {RGK_HF,7,&RawG4sData::hfgfhfb1,"HF (Step7)"},
+   {RGK_HF,8,&RawG4sData::hfgfhfb2,"HF (Step8)"}
+};
 bool RawG4sData::Read(const string &repname) {
-   /* The order of reading strongly depends on the order of the 
-    * report. The report's format is set by the script extractLabFQOTG4Info
-    * (usually: ../../scripts/extractLabFQOTG4Info.sh). */
-   ifstream ifil(repname.c_str());
-   if ( !ifil.good() ) {
-      ScreenUtils::DisplayErrorFileNotOpen(repname);
-      ifil.close();
+   /* The report is mapped and scanned once. The keywords may appear in any
+    * order; the energies (MP2, MP4SDTQ, CCSD(T), and HF) are assigned to
+    * their step using the markers #Step3: ... #Step8:. If the report has
+    * no markers, they are assigned in order of appearance, as the report's
+    * format is set by the script g4-nitro-closed-xxx (see also
+    * G09LogExtractor::WriteReport).  */
+   errorMessages.clear();
+   warningMessages.clear();
+   MappedFile mf(repname);
+   if ( !mf.IsOpen() ) {
+      errorMessages.push_back(string("The file '")+repname+string("' could not be opened!"));
       return false;
    }
+   molecularMass=0.0e0;
+   rotSymmetryNumber=0;
+   rotConstants.clear();
+   bool found[RGK_NKEYS];
+   for ( int k=0 ; k<RGK_NKEYS ; ++k ) { found[k]=false; }
+   bool slotFilled[RAWG4SDATANSLOTS];
+   for ( int k=0 ; k<RAWG4SDATANSLOTS ; ++k ) { slotFilled[k]=false; }
+   int nextSlot=0;
+   int step=0;
    bool ok=true;
-   //From *G41*.log
-   size_t pos=MyParser::GetPosAfterKeyword(ifil,string("ATOMS_IN_MOLECULE"),false);
-   if ( pos!=string::npos ) { std::getline(ifil,atomsInMolecule); } else { ok=false; }
-   pos=MyParser::GetPosAfterKeyword(ifil,string("ALPHA_ELECTRONS"),false);
-   if ( pos!=string::npos ) { ifil >> nElAlpha; } else { ok=false; }
-   pos=MyParser::GetPosAfterKeyword(ifil,string("BETA_ELECTRONS"),false);
-   if ( pos!=string::npos ) { ifil >> nElBeta; } else { ok=false; }
-   //
-   pos=MyParser::GetPosAfterKeyword(ifil,string("METHOD"),false);
-   if ( pos!=string::npos ) { ifil >> method; } else { ok=false; }
-   //*
-   size_t bkppos=pos;
-   pos=MyParser::GetPosAfterKeyword(ifil,string("IS_LINEAR"),false);
-   if ( pos!=string::npos ) {
-      char ttt;
-      ifil >> ttt;
-      islinear=(ttt=='y' || ttt=='Y');
-   } else {
-      ifil.clear(); ifil.seekg(bkppos);
-      ScreenUtils::DisplayWarningMessage("You are using an old report format!\n"
+   const char* p=mf.Data();
+   const char* end=p+mf.Size();
+   const char* lin;
+   size_t len;
+   string tok;
+   while ( NextLine(p,end,lin,len) ) {
+      if ( len==0 ) { continue; }
+      if ( lin[0]=='#' ) {
+         if ( len>5 && std::strncmp(lin,"#Step",5)==0 ) { step=std::atoi(lin+5); }
+         continue;
+      }
+      int id=-1;
+      for ( int k=0 ; k<RGK_NKEYS ; ++k ) {
+         if ( rawG4sDataKeywords[k].len==len && std::memcmp(rawG4sDataKeywords[k].key,lin,len)==0 ) {
+            id=rawG4sDataKeywords[k].id;
+            break;
+         }
+      }
+      if ( id<0 ) { continue; }
+      found[id]=true;
+      switch ( id ) {
+         case RGK_ATOMS :
+            {
+               const char* beg=p;
+               while ( (p<end) && ((*p)!='\n') ) { ++p; }
+               atomsInMolecule.assign(beg,p-beg);
+            }
+            ok=SetupComposition() && ok;
+            break;
+         case RGK_ALPHA :
+            if ( !ReadInteger(p,end,nElAlpha) ) { found[id]=false; }
+            break;
+         case RGK_BETA :
+            if ( !ReadInteger(p,end,nElBeta) ) { found[id]=false; }
+            break;
+         case RGK_METHOD :
+            if ( NextToken(p,end,tok) ) { method=tok; SetupMethod(); } else { found[id]=false; }
+            break;
+         case RGK_ISLINEAR :
+            if ( NextToken(p,end,tok) ) {
+               islinear=(tok[0]=='y' || tok[0]=='Y');
+            } else { found[id]=false; }
+            break;
+         case RGK_ZPE :
+            if ( !ReadDouble(p,end,zpe) ) { found[id]=false; }
+            break;
+         case RGK_FREQS : {
+            int nf;
+            if ( !ReadInteger(p,end,nf) || nf<0 ) { found[id]=false; break; }
+            frequencies.resize(nf);
+            for ( int i=0 ; i<nf ; ++i ) {
+               if ( !ReadDouble(p,end,frequencies[i]) ) {
+                  ok=false;
+                  errorMessages.push_back("Incomplete list of frequencies!");
+                  frequencies.resize(i);
+                  break;
+               }
+               if ( frequencies[i]<0.0e0 ) {
+                  ok=false;
+                  errorMessages.push_back("Imaginary frequency found!");
+               }
+            }
+            break;
+         }
+         case RGK_MASS :
+            ReadDouble(p,end,molecularMass);
+            break;
+         case RGK_SYMNUM :
+            ReadInteger(p,end,rotSymmetryNumber);
+            break;
+         case RGK_ROTCONST : {
+            int nr;
+            if ( !ReadInteger(p,end,nr) || nr<0 ) { break; }
+            rotConstants.resize(nr);
+            for ( int i=0 ; i<nr ; ++i ) {
+               if ( !ReadDouble(p,end,rotConstants[i]) ) { rotConstants.clear(); break; }
+            }
+            break;
+         }
+         default : {
+            /* Energy of steps 3-8.  */
+            int slot=-1;
+            for ( int k=0 ; k<RAWG4SDATANSLOTS ; ++k ) {
+               if ( rawG4sDataSlots[k].id!=id ) { continue; }
+               if ( step>0 ) {
+                  if ( rawG4sDataSlots[k].step==step ) { slot=k; break; }
+               } else if ( k>=nextSlot && !slotFilled[k] ) {
+                  slot=k;
+                  break;
+               }
+            }
+            if ( slot<0 ) {
+               warningMessages.push_back(string("Unexpected keyword '")+string(lin,len)\
+                     +string("' (ignored)."));
+               break;
+            }
+            if ( ReadDouble(p,end,this->*(rawG4sDataSlots[slot].member)) ) {
+               slotFilled[slot]=true;
+               nextSlot=slot+1;
+            }
+            break;
+         }
+      }
+   }
+   mf.Close();
+   const int required[6]={RGK_ATOMS,RGK_ALPHA,RGK_BETA,RGK_METHOD,RGK_ZPE,RGK_FREQS};
+   for ( int k=0 ; k<6 ; ++k ) {
+      if ( !found[required[k]] ) {
+         ok=false;
+         errorMessages.push_back(string("Keyword '")+string(rawG4sDataKeywords[required[k]].key)\
+               +string("' not found (or without value)!"));
+      }
+   }
+   if ( !found[RGK_ISLINEAR] ) {
+      warningMessages.push_back("You are using an old report format!\n"
             "Surmising the molecule is nonlinear...");
    }
-   // */
-   //From *G42*.log
-   pos=MyParser::GetPosAfterKeyword(ifil,string("ZeroPoint"),false);
-   if ( pos!=string::npos ) { ifil >> zpe; } else { ok=false; }
-   pos=MyParser::GetPosAfterKeyword(ifil,string("FREQUENCIES"),false);
-   if ( pos!=string::npos ) {
-      int nf;
-      ifil >> nf;
-      frequencies.resize(nf);
-      for ( int i=0 ; i<nf ; ++i ) {
-         ifil >> frequencies[i];
-         if ( frequencies[i]<0.0e0 ) {
-            ok=false;
-            ScreenUtils::DisplayErrorMessage("Imaginary frequency found!");
-            cout << __FILE__ << ", fnc: " << __FUNCTION__ << ", line: " << __LINE__ << '\n';
-         }
+   for ( int k=0 ; k<RAWG4SDATANSLOTS ; ++k ) {
+      if ( !slotFilled[k] ) {
+         ok=false;
+         errorMessages.push_back(string(rawG4sDataSlots[k].label)+string(" not found!"));
       }
-   } else { ok=false; }
-   //From *G43*.log
-   pos=MyParser::GetPosAfterKeyword(ifil,string("MP2"),false);
-   if ( pos!=string::npos ) { ifil >> mp2gtbas1; } else { ok=false; }
-   pos=MyParser::GetPosAfterKeyword(ifil,string("MP4SDTQ"),false);
-   if ( pos!=string::npos ) { ifil >> mp4gtbas1; } else { ok=false; }
-   pos=MyParser::GetPosAfterKeyword(ifil,string("CCSD(T)"),false);
-   if ( pos!=string::npos ) { ifil >> ccsdtg3bas1; } else { ok=false; }
-   //From *G44*.log
-   pos=MyParser::GetPosAfterKeyword(ifil,string("MP2"),false);
-   if ( pos!=string::npos ) { ifil >> mp2gtbas2; } else { ok=false; }
-   pos=MyParser::GetPosAfterKeyword(ifil,string("MP4SDTQ"),false);
-   if ( pos!=string::npos ) { ifil >> mp4gtbas2; } else { ok=false; }
-   //From *G45*.log
-   pos=MyParser::GetPosAfterKeyword(ifil,string("MP2"),false);
-   if ( pos!=string::npos ) { ifil >> mp2gtbas3; } else { ok=false; }
-   pos=MyParser::GetPosAfterKeyword(ifil,string("MP4SDTQ"),false);
-   if ( pos!=string::npos ) { ifil >> mp4gtbas3; } else { ok=false; }
-   //From *G46*.log
-   pos=MyParser::GetPosAfterKeyword(ifil,string("HF"),false);
-   if ( pos!=string::npos ) { ifil >> hfgtlargexp; } else { ok=false; }
-   pos=MyParser::GetPosAfterKeyword(ifil,string("MP2"),false);
-   if ( pos!=string::npos ) { ifil >> mp2gtlargexp; } else { ok=false; }
-   //From *G47*.log
-   pos=MyParser::GetPosAfterKeyword(ifil,string("HF"),false);
-   if ( pos!=string::npos ) { ifil >> hfgfhfb1; } else { ok=false; }
-   //From *G48*.log
-   pos=MyParser::GetPosAfterKeyword(ifil,string("HF"),false);
-   if ( pos!=string::npos ) { ifil >> hfgfhfb2; } else { ok=false; }
-   //
-   ifil.close();
+   }
    /* This needs to be read from report.  */
-   if ( nElAlpha!=nElBeta ) {
-      ScreenUtils::DisplayWarningMessage("Only closed shell molecules can be correctly analized!");
+   if ( found[RGK_ALPHA] && found[RGK_BETA] && nElAlpha!=nElBeta ) {
+      warningMessages.push_back("Only closed shell molecules can be correctly analized!");
       ok=false;
-      cout << __FILE__ << ", line: " << __LINE__ << endl;
    }
    return ok;
 }
+bool RawG4sData::NextLine(const char* &p,const char* end,const char* &lin,size_t &len) {
+   if ( p>=end ) { return false; }
+   const char* beg=p;
+   while ( (p<end) && ((*p)!='\n') ) { ++p; }
+   const char* lend=p;
+   if ( p<end ) { ++p; }
+   while ( (beg<lend) && (*beg==' ' || *beg=='\t' || *beg=='\r') ) { ++beg; }
+   while ( (lend>beg) && (lend[-1]==' ' || lend[-1]=='\t' || lend[-1]=='\r') ) { --lend; }
+   lin=beg;
+   len=size_t(lend-beg);
+   return true;
+}
+bool RawG4sData::NextToken(const char* &p,const char* end,const char* &tok,size_t &len) {
+   while ( (p<end) && std::isspace(static_cast<unsigned char>(*p)) ) { ++p; }
+   if ( p>=end ) { return false; }
+   tok=p;
+   while ( (p<end) && !std::isspace(static_cast<unsigned char>(*p)) ) { ++p; }
+   len=size_t(p-tok);
+   return true;
+}
+bool RawG4sData::NextToken(const char* &p,const char* end,string &tok) {
+   const char* t;
+   size_t len;
+   if ( !NextToken(p,end,t,len) ) { return false; }
+   tok.assign(t,len);
+   return true;
+}
+bool RawG4sData::ReadDouble(const char* &p,const char* end,double &val) {
+   const char* t;
+   size_t len;
+   const char* bkp=p;
+   if ( !NextToken(p,end,t,len) || len>63 ) { p=bkp; return false; }
+   /* The mapped file is not null-terminated; strtod works on a copy.  */
+   char buf[64];
+   std::memcpy(buf,t,len);
+   buf[len]='\0';
+   char* endp;
+   double v=std::strtod(buf,&endp);
+   if ( endp==buf ) { p=bkp; return false; }
+   val=v;
+   return true;
+}
+bool RawG4sData::ReadInteger(const char* &p,const char* end,int &val) {
+   const char* t;
+   size_t len;
+   const char* bkp=p;
+   if ( !NextToken(p,end,t,len) || len>63 ) { p=bkp; return false; }
+   char buf[64];
+   std::memcpy(buf,t,len);
+   buf[len]='\0';
+   char* endp;
+   long v=std::strtol(buf,&endp,10);
+   if ( endp==buf ) { p=bkp; return false; }
+   val=int(v);
+   return true;
+}
+bool RawG4sData::SetupComposition() {
+   compZ.clear();
+   compCount.clear();
+   std::map<int,int> cnt;
+   std::istringstream iss(atomsInMolecule);
+   string symb;
+   bool ok=true;
+   int nAt;
+   while ( iss >> symb ) {
+      if ( symb==string("X") ) { continue; }
+      nAt=Atom::FindAtomicNumber(symb);
+      if ( nAt==0 ) {
+         errorMessages.push_back(string("Unknown atom! ")+symb);
+         ok=false;
+         continue;
+      }
+      ++cnt[nAt];
+   }
+   for ( std::map<int,int>::const_iterator it=cnt.begin() ; it!=cnt.end() ; ++it ) {
+      compZ.push_back(it->first);
+      compCount.push_back(it->second);
+   }
+   return ok;
+}
+bool RawG4sData::SetupMethod() {
+   g4method=G4Methods::GetMethod(method);
+   if ( g4method==G4Method::UNKNOWN ) {
+      warningMessages.push_back(string("Unknown method '")+method+string("'!"));
+      return false;
+   }
+   return true;
+}
+int RawG4sData::NumberOfAtoms() const {
+   int res=0;
+   for ( size_t i=0 ; i<compCount.size() ; ++i ) { res+=compCount[i]; }
+   return res;
+}
+bool RawG4sData::HasThermochemistryData() const {
+   return ( molecularMass>0.0e0 && rotSymmetryNumber>0 && rotConstants.size()>0 );
+}
+void RawG4sData::DisplayMessages() const {
+   for ( size_t i=0 ; i<warningMessages.size() ; ++i ) {
+      ScreenUtils::DisplayWarningMessage(warningMessages[i]);
+   }
+   for ( size_t i=0 ; i<errorMessages.size() ; ++i ) {
+      ScreenUtils::DisplayErrorMessage(errorMessages[i]);
+   }
+}
 void RawG4sData::DisplayResults() {
    cout << scientific << setprecision(10);
    ScreenUtils::PrintScrStarLine();
@@ -189,6 +414,14 @@ void RawG4sData::DisplayResults() {
    cout << "hfgfhfb1:     " << (hfgfhfb1>0.0e0? "  " : " ") << hfgfhfb1 << '\n';
    ScreenUtils::PrintScrCharLine('-');
    cout << "hfgfhfb2:     " << (hfgfhfb2>0.0e0? "  " : " ") << hfgfhfb2 << '\n';
+   if ( HasThermochemistryData() ) {
+      ScreenUtils::PrintScrCharLine('-');
+      cout << "Molecular mass (amu):      " << molecularMass << '\n';
+      cout << "Rot. symmetry number:      " << rotSymmetryNumber << '\n';
+      cout << "Rot. constants (GHz):     ";
+      for ( size_t i=0 ; i<rotConstants.size() ; ++i ) { cout << ' ' << rotConstants[i]; }
+      cout << '\n';
+   }
    //ScreenUtils::PrintScrCharLine('-');
    //cout << " Energies from Statistical Thermodynamics (hartrees): " << '\n';
    //cout << "Evib (a.u.)   :" << EvibH << '\n';
@@ -45,6 +45,7 @@
 using std::vector;
 #include <string>
 using std::string;
+#include "g4methods.h"
 
 /* ************************************************************************** */
 class RawG4sData {
@@ -54,10 +55,26 @@ public:
    RawG4sData();
    RawG4sData(const string &repname);
 /* ************************************************************************** */
+   /** Reads the report repname. This function does not write to the screen;
+    * the errors and warnings are saved, and they can be displayed
+    * with DisplayMessages(). Thus, Read can be called concurrently
+    * on different objects.  */
    bool Read(const string &repname);
    bool ImSetup() {return imsetup;}
+   const vector<string> &ErrorMessages() const { return errorMessages; }
+   const vector<string> &WarningMessages() const { return warningMessages; }
+   void DisplayMessages() const;
+   /** Fills compZ and compCount from atomsInMolecule. Returns false if
+    * an unknown symbol is found. It is called by Read.  */
+   bool SetupComposition();
+   /** Sets g4method from method. Returns false (and saves a warning) if
+    * the method is unknown. It is called by Read.  */
+   bool SetupMethod();
+   /** Returns the total number of atoms (without dummy atoms).  */
+   int NumberOfAtoms() const;
 /* ************************************************************************** */
    string method;
+   G4Method g4method; /*!< method, resolved once (see SetupMethod).  */
    bool islinear;
    double zpe; //From step 2 (name: *G42*.log)
    double mp2gtbas1,mp4gtbas1,ccsdtg3bas1; //From step 3 (name: *G43*.log)
@@ -69,13 +86,37 @@ public:
    int nElAlpha;
    int nElBeta;
    string atomsInMolecule;
+   /** Composition of the molecule, parsed once from atomsInMolecule
+    * (see SetupComposition). compZ holds the atomic numbers of the
+    * elements (increasing order), and compCount[i] holds the number of atoms
+    * whose atomic number is compZ[i]. Dummy atoms (X) are not included.  */
+   vector<int> compZ;
+   vector<int> compCount;
    vector<double> frequencies;
+   /** Optional data (thermochemistry section of step 2), only needed by
+    * ThermoScan. Old reports do not have it: molecularMass and
+    * rotSymmetryNumber are then zero, and rotConstants is empty.  */
+   double molecularMass; /*!< In amu.  */
+   int rotSymmetryNumber;
+   vector<double> rotConstants; /*!< In GHz (one value for linear molecules).  */
+   /** Returns true if the optional data needed by ThermoScan is available.  */
+   bool HasThermochemistryData() const;
 /* ************************************************************************** */
    void DisplayResults();
 /* ************************************************************************** */
 protected:
 /* ************************************************************************** */
+   /** Helpers of Read. They work on [p,end) (the mapped report), and advance p.
+    * NextLine returns the line without leading/trailing blanks.  */
+   static bool NextLine(const char* &p,const char* end,const char* &lin,size_t &len);
+   static bool NextToken(const char* &p,const char* end,const char* &tok,size_t &len);
+   static bool NextToken(const char* &p,const char* end,string &tok);
+   static bool ReadDouble(const char* &p,const char* end,double &val);
+   static bool ReadInteger(const char* &p,const char* end,int &val);
    bool imsetup;
+   vector<string> errorMessages;
+   vector<string> warningMessages;
+   friend class G09LogExtractor;
 /* ************************************************************************** */
 };
 /* ************************************************************************** */
@@ -0,0 +1,144 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cmath>
+#include <iomanip>
+using std::setprecision;
+#include "thermoscan.h"
+#include "screenutils.h"
+#include "physicalconstants.h"
+#include "g4atomicproperties.h"
+
+ThermoScan::ThermoScan() {
+   pressure=PhysicalConstants::atm;
+}
+void ThermoScan::LinearGrid(const double tmin,const double tmax,const size_t n,vector<double> &tt) {
+   tt.resize(n);
+   if ( n==0 ) { return; }
+   if ( n==1 ) { tt[0]=tmin; return; }
+   double dt=(tmax-tmin)/double(n-1);
+   for ( size_t i=0 ; i<n ; ++i ) { tt[i]=tmin+double(i)*dt; }
+   tt[n-1]=tmax;
+}
+bool ThermoScan::Compute(const RawG4sData &rd,const double g4e,const double ff,\
+      const vector<double> &tt) {
+   errorMessages.clear();
+   temp.clear(); enth.clear(); entr.clear(); cp.clear(); gibbs.clear();
+   if ( !rd.HasThermochemistryData() ) {
+      errorMessages.push_back("The report lacks the molecular mass, the rotational symmetry"
+            " number, or the rotational constants!");
+      errorMessages.push_back("(Regenerate the report with --g09-log and --save-report.)");
+      return false;
+   }
+   for ( size_t k=0 ; k<tt.size() ; ++k ) {
+      if ( !(tt[k]>0.0e0) ) {
+         errorMessages.push_back("The temperatures must be positive!");
+         return false;
+      }
+   }
+   const size_t nt=tt.size();
+   temp=tt;
+   enth.resize(nt); entr.resize(nt); cp.resize(nt); gibbs.resize(nt);
+   evib.resize(nt); svib.resize(nt); cvvib.resize(nt);
+   if ( nt==0 ) { return true; }
+   vibk.Setup(rd.frequencies,ff);
+   vibk.ComputeThermo(temp.data(),nt,evib.data(),svib.data(),cvvib.data());
+   const double R=PhysicalConstants::R;
+   const double kB=PhysicalConstants::kB;
+   const double h=PhysicalConstants::h;
+   const double J2H=G4AtomicProperties::JPMole2Hartree;
+   /* Translational partition function: qt=(2 pi m kB T/h^2)^{3/2} kB T/P
+    *   ln(qt)=lnTrans+2.5 ln(T).
+    * Rotational partition function (nonlinear):
+    *   qr=sqrt(pi)/sigma T^{3/2}/sqrt(ThetaA ThetaB ThetaC),
+    * or qr=T/(sigma Theta) (linear), with Theta=h B/kB
+    *   ln(qr)=lnRot+(1.5 or 1) ln(T).  */
+   double mass=rd.molecularMass*PhysicalConstants::amu;
+   double lnTrans=1.5e0*log(2.0e0*M_PI*mass*kB/(h*h))+log(kB/pressure);
+   double sigma=double(rd.rotSymmetryNumber);
+   double lnRot,rotFact;
+   if ( rd.islinear ) {
+      double theta=h*(rd.rotConstants.back()*1.0e+09)/kB;
+      lnRot=-log(sigma*theta);
+      rotFact=1.0e0;
+   } else {
+      if ( rd.rotConstants.size()<3 ) {
+         errorMessages.push_back("Three rotational constants are needed for nonlinear molecules!");
+         return false;
+      }
+      double prodTheta=1.0e0;
+      for ( int i=0 ; i<3 ; ++i ) { prodTheta*=(h*(rd.rotConstants[i]*1.0e+09)/kB); }
+      lnRot=0.5e0*log(M_PI/prodTheta)-log(sigma);
+      rotFact=1.5e0;
+   }
+   double T,lnT,RT,Strans,Srot;
+   for ( size_t k=0 ; k<nt ; ++k ) {
+      T=temp[k];
+      lnT=log(T);
+      /* Same order as in CalculateG4::ComputeAllVariants.  */
+      RT=R*T*J2H;
+      enth[k]=g4e+evib[k]*J2H+rotFact*RT+1.5e0*RT+RT;
+      Strans=R*(lnTrans+2.5e0*lnT+2.5e0);
+      Srot=R*(lnRot+rotFact*lnT+rotFact);
+      entr[k]=Strans+Srot+svib[k];
+      cp[k]=cvvib[k]+rotFact*R+1.5e0*R+R;
+      gibbs[k]=enth[k]-T*entr[k]*J2H;
+   }
+   return true;
+}
+void ThermoScan::PrintTable(ostream &ofil) const {
+   ofil << "#T H S Cp G\n";
+   ofil << "#(T in K; H and G in hartree; S and Cp in J mol-1 K-1)\n";
+   std::streamsize oldprec=ofil.precision();
+   for ( size_t k=0 ; k<temp.size() ; ++k ) {
+      ofil << setprecision(8) << temp[k];
+      ofil << setprecision(10) << ' ' << enth[k];
+      ofil << setprecision(8) << ' ' << entr[k] << ' ' << cp[k];
+      ofil << setprecision(10) << ' ' << gibbs[k] << '\n';
+   }
+   ofil.precision(oldprec);
+}
+void ThermoScan::DisplayMessages() const {
+   for ( size_t i=0 ; i<errorMessages.size() ; ++i ) {
+      ScreenUtils::DisplayErrorMessage(errorMessages[i]);
+   }
+}
+
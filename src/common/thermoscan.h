@@ -0,0 +1,112 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _THERMOSCAN_H_
+#define _THERMOSCAN_H_
+#include <ostream>
+using std::ostream;
+#include <vector>
+using std::vector;
+#include <string>
+using std::string;
+#include "rawg4sdata.h"
+#include "g4vibkernel.h"
+
+/* ************************************************************************** */
+/** This class computes the thermochemistry of a molecule, within the ideal
+ * gas, HO-RR approximation, over a grid of temperatures, e.g. for
+ * fitting NASA polynomials. For each temperature T it computes
+ * H(T) (the G4 enthalpy, i.e. G4(0 K)+Evib(T)+Erot(T)+Etrans(T)+RT),
+ * S(T) (translational, rotational, and vibrational contributions; the
+ * molecule must be a closed shell singlet, so there is no electronic
+ * contribution), Cp(T)=Cv(T)+R, and G(T)=H(T)-TS(T). The standard pressure is
+ * 1 atm (as in Gaussian), see SetPressure.
+ * The vibrational sums are computed with G4VibKernel::ComputeThermo.
+ * Besides the frequencies, the molecular mass, the rotational symmetry number,
+ * and the rotational constants are needed (see RawG4sData); reports
+ * created by old versions lack these data (use the option --g09-log
+ * together with --save-report for writing a new report).
+ * At T=298.15 K, H is the same as CalculateG4::G4Enthalpy0K (HO-RR).
+ * As in CalculateG4, errors are saved (and displayed with DisplayMessages). */
+class ThermoScan {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   ThermoScan();
+   /** Builds a grid of n evenly spaced temperatures, from tmin to tmax (both
+    * included).  */
+   static void LinearGrid(const double tmin,const double tmax,const size_t n,vector<double> &tt);
+   /** Computes the thermochemistry of the molecule rd, at the temperatures tt
+    * (in K). g4e is the G4 energy at 0 K (see CalculateG4::G4Energy), and ff
+    * the frequency scaling factor. Returns false if the data is not
+    * enough.  */
+   bool Compute(const RawG4sData &rd,const double g4e,const double ff,const vector<double> &tt);
+   /** Pressure (in Pa) used for the translational entropy. Default: 1 atm.  */
+   void SetPressure(const double pp) { pressure=pp; }
+   size_t Size() const { return temp.size(); }
+   const vector<double> &Temperatures() const { return temp; }
+   /** Enthalpy, in hartrees.  */
+   const vector<double> &Enthalpy() const { return enth; }
+   /** Entropy, in J/(mol K).  */
+   const vector<double> &Entropy() const { return entr; }
+   /** Heat capacity at constant pressure, in J/(mol K).  */
+   const vector<double> &HeatCapacity() const { return cp; }
+   /** Gibbs free energy, in hartrees.  */
+   const vector<double> &GibbsEnergy() const { return gibbs; }
+   /** Writes one line per temperature: T H S Cp G.  */
+   void PrintTable(ostream &ofil) const;
+   const vector<string> &ErrorMessages() const { return errorMessages; }
+   void DisplayMessages() const;
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   double pressure;
+   G4VibKernel vibk;
+   vector<double> temp,enth,entr,cp,gibbs;
+   vector<double> evib,svib,cvvib;
+   vector<string> errorMessages;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _THERMOSCAN_H_ */
+
@@ -0,0 +1,141 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include "workstealingpool.h"
+
+WorkStealingPool::WorkStealingPool(size_t nthr) {
+   if ( nthr==0 ) { nthr=size_t(std::thread::hardware_concurrency()); }
+   if ( nthr==0 ) { nthr=1; }
+   nThreads=nthr;
+   job=nullptr;
+   pendingTasks=0;
+   generation=0;
+   busyWorkers=0;
+   stop=false;
+   for ( size_t i=0 ; i<nThreads ; ++i ) {
+      queues.push_back(std::unique_ptr<TaskQueue>(new TaskQueue()));
+   }
+   /* The calling thread acts as worker 0.  */
+   for ( size_t i=1 ; i<nThreads ; ++i ) {
+      workers.push_back(std::thread(&WorkStealingPool::WorkerLoop,this,i));
+   }
+}
+WorkStealingPool::~WorkStealingPool() {
+   {
+      std::lock_guard<std::mutex> lck(poolMtx);
+      stop=true;
+   }
+   cvStart.notify_all();
+   for ( size_t i=0 ; i<workers.size() ; ++i ) { workers[i].join(); }
+}
+void WorkStealingPool::ParallelFor(const size_t n,const std::function<void(size_t)> &fnc) {
+   if ( n==0 ) { return; }
+   if ( nThreads==1 ) {
+      for ( size_t i=0 ; i<n ; ++i ) { fnc(i); }
+      return;
+   }
+   /* Contiguous blocks are given to each queue, so that neighbouring
+    * tasks tend to be run by the same thread.  */
+   for ( size_t q=0 ; q<nThreads ; ++q ) {
+      size_t beg=(q*n)/nThreads;
+      size_t end=((q+1)*n)/nThreads;
+      std::lock_guard<std::mutex> lck(queues[q]->mtx);
+      for ( size_t i=beg ; i<end ; ++i ) { queues[q]->tasks.push_back(i); }
+   }
+   {
+      std::lock_guard<std::mutex> lck(poolMtx);
+      job=&fnc;
+      pendingTasks=n;
+      busyWorkers=workers.size();
+      ++generation;
+   }
+   cvStart.notify_all();
+   RunTasks(0);
+   std::unique_lock<std::mutex> lck(poolMtx);
+   cvDone.wait(lck,[this]{ return busyWorkers==0; });
+   job=nullptr;
+}
+void WorkStealingPool::WorkerLoop(const size_t id) {
+   size_t lastGeneration=0;
+   while ( true ) {
+      {
+         std::unique_lock<std::mutex> lck(poolMtx);
+         cvStart.wait(lck,[this,lastGeneration]{ return stop || generation!=lastGeneration; });
+         if ( stop ) { return; }
+         lastGeneration=generation;
+      }
+      RunTasks(id);
+      {
+         std::lock_guard<std::mutex> lck(poolMtx);
+         --busyWorkers;
+      }
+      cvDone.notify_one();
+   }
+}
+void WorkStealingPool::RunTasks(const size_t id) {
+   size_t task;
+   while ( pendingTasks.load()>0 ) {
+      if ( !GetTask(id,task) ) { break; }
+      (*job)(task);
+      --pendingTasks;
+   }
+}
+bool WorkStealingPool::GetTask(const size_t id,size_t &task) {
+   {
+      std::lock_guard<std::mutex> lck(queues[id]->mtx);
+      if ( !queues[id]->tasks.empty() ) {
+         task=queues[id]->tasks.back();
+         queues[id]->tasks.pop_back();
+         return true;
+      }
+   }
+   for ( size_t k=1 ; k<nThreads ; ++k ) {
+      size_t victim=(id+k)%nThreads;
+      std::lock_guard<std::mutex> lck(queues[victim]->mtx);
+      if ( !queues[victim]->tasks.empty() ) {
+         task=queues[victim]->tasks.front();
+         queues[victim]->tasks.pop_front();
+         return true;
+      }
+   }
+   return false;
+}
+
@@ -0,0 +1,110 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _WORKSTEALINGPOOL_H_
+#define _WORKSTEALINGPOOL_H_
+#include <cstddef>
+#include <vector>
+using std::vector;
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+/* ************************************************************************** */
+/** A simple work-stealing thread pool for loops over independent tasks.
+ * Each worker owns a double-ended queue of task indices. A worker takes
+ * tasks from the back of its own queue, and, when it runs out of work,
+ * steals from the front of the queues of the other workers. The workers
+ * are created once (in the constructor) and reused by every call to
+ * ParallelFor. The pool does not impose any order on the execution of
+ * the tasks; deterministic output is obtained by saving the result of
+ * task i into slot i of a preallocated container.  */
+class WorkStealingPool {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   /** Creates a pool with nthr threads. If nthr is zero, the number of
+    * hardware threads is used. If the pool has only one thread, the tasks
+    * are executed by the calling thread (no threads are created).  */
+   explicit WorkStealingPool(size_t nthr=0);
+   ~WorkStealingPool();
+   size_t NumberOfThreads() const { return nThreads; }
+   /** Calls fnc(i), for i=0,...,(n-1), distributing the calls among the
+    * threads of the pool. Returns when all the calls have finished.
+    * fnc must be safe to call concurrently with different indices.  */
+   void ParallelFor(const size_t n,const std::function<void(size_t)> &fnc);
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   struct TaskQueue {
+      std::mutex mtx;
+      std::deque<size_t> tasks;
+   };
+   WorkStealingPool(const WorkStealingPool &) = delete;
+   WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+   void WorkerLoop(const size_t id);
+   /** Gets a task from the own queue (back); if it is empty, tries to
+    * steal a task from the other queues (front). Returns false if there
+    * is no work left.  */
+   bool GetTask(const size_t id,size_t &task);
+   void RunTasks(const size_t id);
+   size_t nThreads;
+   vector<std::thread> workers;
+   vector<std::unique_ptr<TaskQueue> > queues;
+   std::mutex poolMtx;
+   std::condition_variable cvStart;
+   std::condition_variable cvDone;
+   const std::function<void(size_t)> *job;
+   std::atomic<size_t> pendingTasks;
+   size_t generation;
+   size_t busyWorkers;
+   bool stop;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _WORKSTEALINGPOOL_H_ */
+
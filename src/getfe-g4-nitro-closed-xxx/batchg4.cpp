@@ -0,0 +1,202 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#include <cstdlib>
+#include <iostream>
+using std::cout;
+using std::endl;
+#include <iomanip>
+using std::setprecision;
+#include "batchg4.h"
+#include "fileutils.h"
+#include "screenutils.h"
+#include "workstealingpool.h"
+#include "mappedfile.h"
+
+const char* BatchG4::reportSuffix="-ReportG09.dat";
+
+BatchG4::BatchG4() {
+   scalingFreqFact=A=alpha=M=T1d=G=LHGap=0.0e0;
+   usrScaleFact=usrConstantA=usrAlpha=false;
+   usrConstantM=usrT1Diag=usrConstantG=usrLHGap=false;
+   cacheHits=0;
+   cacheFailures=0;
+}
+vector<string> BatchG4::GetListOfReports(const string &src) {
+   if ( FileUtils::IsDirectory(src) ) {
+      return FileUtils::ListFilesInDirectory(src,string(reportSuffix));
+   }
+   if ( src.find_first_of("*?[")!=string::npos ) {
+      return FileUtils::ExpandGlobPattern(src);
+   }
+   string sfx=reportSuffix;
+   if ( src.size()>=sfx.size() && src.compare(src.size()-sfx.size(),sfx.size(),sfx)==0 ) {
+      return vector<string>(1,src);
+   }
+   return FileUtils::ReadListOfFileNames(src);
+}
+bool BatchG4::SetupListOfReports(const string &src) {
+   repNames=GetListOfReports(src);
+   if ( repNames.size()==0 ) {
+      ScreenUtils::DisplayErrorMessage(string("No reports were found in '")+src+string("'."));
+      cout << __FILE__ << ", line: " << __LINE__ << endl;
+      return false;
+   }
+   results.clear();
+   results.resize(repNames.size());
+   return true;
+}
+size_t BatchG4::NumberOfFailures() const {
+   size_t res=0;
+   for ( size_t i=0 ; i<results.size() ; ++i ) { if ( !results[i].ok ) { ++res; } }
+   return res;
+}
+bool BatchG4::UseCache(const string &fname) {
+   return cache.Open(fname);
+}
+void BatchG4::Run(const size_t nthr) {
+   cacheHits=0;
+   cacheFailures=0;
+   WorkStealingPool pool(nthr);
+   pool.ParallelFor(repNames.size(),[this](size_t i){ ComputeReport(i); });
+   if ( cacheFailures>0 ) {
+      ScreenUtils::DisplayWarningMessage(string("The cache '")+cache.FileName()+\
+            string("' could not be updated (")+std::to_string(size_t(cacheFailures))+\
+            string(" results were not saved)!"));
+   }
+}
+void BatchG4::DisplayMessages() const {
+   for ( size_t i=0 ; i<results.size() ; ++i ) {
+      const BatchG4Result &r=results[i];
+      for ( size_t j=0 ; j<r.warningMessages.size() ; ++j ) {
+         ScreenUtils::DisplayWarningMessage(r.repName+string(": ")+r.warningMessages[j]);
+      }
+      for ( size_t j=0 ; j<r.errorMessages.size() ; ++j ) {
+         ScreenUtils::DisplayErrorMessage(r.repName+string(": ")+r.errorMessages[j]);
+      }
+   }
+}
+void BatchG4::ApplyUserParameters(CalculateG4 &cg) const {
+   if ( usrScaleFact ) { cg.SetScalingFreqencyFactor(scalingFreqFact); }
+   if ( usrConstantA ) { cg.SetConstantA(A); }
+   if ( usrAlpha ) { cg.SetAlpha(alpha); }
+   if ( usrConstantM ) { cg.SetConstantM(M); }
+   if ( usrT1Diag ) { cg.SetT1Diag(T1d); }
+   if ( usrConstantG ) { cg.SetConstantG(G); }
+   if ( usrLHGap ) { cg.SetLHGap(LHGap); }
+}
+G4ResultCache::Key BatchG4::GetCacheKey(const char* rep,size_t len) const {
+   const double prm[14]={
+      (usrScaleFact ? 1.0e0 : 0.0e0),(usrScaleFact ? scalingFreqFact : 0.0e0),
+      (usrConstantA ? 1.0e0 : 0.0e0),(usrConstantA ? A : 0.0e0),
+      (usrAlpha ? 1.0e0 : 0.0e0),(usrAlpha ? alpha : 0.0e0),
+      (usrConstantM ? 1.0e0 : 0.0e0),(usrConstantM ? M : 0.0e0),
+      (usrT1Diag ? 1.0e0 : 0.0e0),(usrT1Diag ? T1d : 0.0e0),
+      (usrConstantG ? 1.0e0 : 0.0e0),(usrConstantG ? G : 0.0e0),
+      (usrLHGap ? 1.0e0 : 0.0e0),(usrLHGap ? LHGap : 0.0e0)
+   };
+   return G4ResultCache::ComputeKey(rep,len,prm,14);
+}
+void BatchG4::ComputeReport(const size_t idx) {
+   BatchG4Result &res=results[idx];
+   res.repName=repNames[idx];
+   G4ResultWriter::SetFailedRow(res);
+   res.errorMessages.clear();
+   res.warningMessages.clear();
+   G4ResultCache::Key key;
+   bool usecache=cache.IsOpen();
+   if ( usecache ) {
+      MappedFile mf(repNames[idx]);
+      usecache=mf.IsOpen();
+      if ( usecache ) {
+         key=GetCacheKey(mf.Data(),mf.Size());
+         G4Variants var;
+         if ( cache.Lookup(key,var) ) {
+            G4ResultWriter::SetRow(var,res);
+            ++cacheHits;
+            return;
+         }
+      }
+   }
+   RawG4sData data;
+   bool readok=data.Read(repNames[idx]);
+   res.errorMessages=data.ErrorMessages();
+   res.warningMessages=data.WarningMessages();
+   if ( !readok ) { return; }
+   CalculateG4 cg(data,0);
+   ApplyUserParameters(cg);
+   G4Variants var=cg.ComputeAllVariants();
+   res.errorMessages.insert(res.errorMessages.end(),\
+         cg.ErrorMessages().begin(),cg.ErrorMessages().end());
+   res.warningMessages.insert(res.warningMessages.end(),\
+         cg.WarningMessages().begin(),cg.WarningMessages().end());
+   if ( !cg.ComputeOK() ) { return; }
+   G4ResultWriter::SetRow(var,res);
+   if ( usecache && res.errorMessages.size()==0 && res.warningMessages.size()==0 ) {
+      if ( !cache.Insert(key,var) ) { ++cacheFailures; }
+   }
+}
+void BatchG4::PrintTable(ostream &ofil) const {
+   ofil << "#Report lclZPE scaledZPE G4(0K) G4Enthalpy"
+        << " dHf[HO-RR]/NIST dHf[HO-RR]/Tajti dHf[HO-RR]/ATcT"
+        << " dHf[Nicolaides]/NIST dHf[Nicolaides]/Tajti dHf[Nicolaides]/ATcT\n";
+   ofil << "#(Energies in hartree; enthalpies of formation, at 298.15 K, in kJ mol-1)\n";
+   std::streamsize oldprec=ofil.precision();
+   for ( size_t i=0 ; i<results.size() ; ++i ) {
+      const BatchG4Result &r=results[i];
+      ofil << r.repName << setprecision(10);
+      ofil << ' ' << r.lclZPE << ' ' << r.scaledZPE;
+      ofil << ' ' << r.g4Energy << ' ' << r.g4Enthalpy0K;
+      ofil << setprecision(5);
+      for ( int j=0 ; j<6 ; ++j ) { ofil << ' ' << r.deltaHf298K[j]; }
+      ofil << '\n';
+   }
+   ofil.precision(oldprec);
+}
+
+bool BatchG4::WriteResults(const string &fname,const G4ResultWriter::Format fmt) const {
+   G4ResultWriter wrt;
+   if ( !wrt.Open(fname,fmt) ) { return false; }
+   for ( size_t i=0 ; i<results.size() ; ++i ) {
+      wrt.Write(results[i].repName,results[i]);
+   }
+   return wrt.Close();
+}
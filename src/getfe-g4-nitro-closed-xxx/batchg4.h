@@ -0,0 +1,143 @@
+/*
+                      This source code is part of
+  
+                 G 4 - N I T R O - C L O S E D - X X X
+  
+                           VERSION: 1.0.0
+  
+               Contributors: Juan Manuel Solano-Altamirano
+                             Julio Manuel Hernández-Pérez
+          Copyright (c) 2024-2025, Juan Manuel Solano-Altamirano
+                                   <jmsolanoalt@gmail.com>
+  
+   -------------------------------------------------------------------
+  
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+  
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+  
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  
+   ---------------------------------------------------------------------
+  
+   If you want to redistribute modifications of the suite, please
+   consider to include your modifications in our official release.
+   We will be pleased to consider the inclusion of your code
+   within the official distribution. Please keep in mind that
+   scientific software is very special, and version control is 
+   crucial for tracing bugs. If in despite of this you distribute
+   your modified version, please do not call it DensToolKit.
+  
+   If you find DensToolKit useful, we humbly ask that you cite
+   the paper(s) on the package --- you can find them on the top
+   README file.
+*/
+#ifndef _BATCHG4_H_
+#define _BATCHG4_H_
+#include <string>
+using std::string;
+#include <vector>
+using std::vector;
+#include <ostream>
+using std::ostream;
+#include "rawg4sdata.h"
+#include "calculateg4.h"
+#include "g4resultcache.h"
+#include "g4resultwriter.h"
+#include <atomic>
+
+/* ************************************************************************** */
+/** Results of a single report within a batch (see G4ResultRow for the
+ * order of the enthalpies of formation).  */
+struct BatchG4Result : public G4ResultRow {
+   string repName;
+   vector<string> errorMessages;
+   vector<string> warningMessages;
+};
+/* ************************************************************************** */
+/** This class computes the G4 energies of a set of molecules (reports) within
+ * a single process. The list of reports can be given as a directory
+ * (all the files *-ReportG09.dat it contains are used), a glob pattern
+ * (e.g. "dir/ch*-ReportG09.dat"), or a manifest file (a plain text file
+ * containing one report name per line).
+ * The reports are computed concurrently (see WorkStealingPool); each task
+ * uses its own RawG4sData and CalculateG4 objects, and writes its results
+ * into its own slot of the results vector, so the output is always written
+ * in the order of the list of reports.  */
+class BatchG4 {
+/* ************************************************************************** */
+public:
+/* ************************************************************************** */
+   BatchG4();
+   /** Sets up the list of reports from src (directory, glob pattern, or
+    * manifest). Returns false if no report could be found.  */
+   bool SetupListOfReports(const string &src);
+   /** Returns the list of reports of src (directory, glob pattern, or
+    * manifest). If src is a file whose name ends with reportSuffix, the
+    * list contains only src.  */
+   static vector<string> GetListOfReports(const string &src);
+   size_t NumberOfReports() const { return repNames.size(); }
+   size_t NumberOfFailures() const;
+   /** Computes all the reports of the list, using nthr threads
+    * (nthr=0 means all the available hardware threads).  */
+   void Run(const size_t nthr=0);
+   /** Writes one row per report. Failed reports are written with nan values. */
+   void PrintTable(ostream &ofil) const;
+   /** Writes one row per report to fname (or to the standard output, if
+    * fname is empty), as JSON Lines or CSV (see G4ResultWriter).  */
+   bool WriteResults(const string &fname,const G4ResultWriter::Format fmt) const;
+   /** Displays (in order) the errors and warnings found for every report.  */
+   void DisplayMessages() const;
+   const vector<BatchG4Result> &Results() const { return results; }
+   /** Uses (or creates) the result cache fname (see G4ResultCache). Reports
+    * found in the cache are not read nor computed. Only results without
+    * errors or warnings are saved into the cache.  */
+   bool UseCache(const string &fname);
+   /** Number of reports taken from the cache in the last call to Run.  */
+   size_t NumberOfCacheHits() const { return cacheHits; }
+   /** Number of results that could not be saved into the cache in the last
+    * call to Run (a warning is displayed by Run if any).  */
+   size_t NumberOfCacheFailures() const { return cacheFailures; }
+/* ************************************************************************** */
+   /** The following setters have the same meaning as their counterparts of
+    * CalculateG4, but they are applied to every report of the batch.  */
+   void SetScalingFreqencyFactor(const double ff) { usrScaleFact=true; scalingFreqFact=ff; }
+   void SetConstantA(const double aa) { usrConstantA=true; A=aa; }
+   void SetAlpha(const double aa) { usrAlpha=true; alpha=aa; }
+   void SetConstantM(const double mm) { usrConstantM=true; M=mm; }
+   void SetT1Diag(const double t1) { usrT1Diag=true; T1d=t1; }
+   void SetConstantG(const double gg) { usrConstantG=true; G=gg; }
+   void SetLHGap(const double gap) { usrLHGap=true; LHGap=gap; }
+/* ************************************************************************** */
+   static const char* reportSuffix;
+/* ************************************************************************** */
+protected:
+/* ************************************************************************** */
+   /** Computes the report repNames[idx] and saves the results into results[idx]. */
+   void ComputeReport(const size_t idx);
+   /** Applies the user-defined parameters to cg (see ComputeReport).  */
+   void ApplyUserParameters(CalculateG4 &cg) const;
+   /** Computes the cache key of the report whose bytes are rep[0..len-1].  */
+   G4ResultCache::Key GetCacheKey(const char* rep,size_t len) const;
+   vector<string> repNames;
+   vector<BatchG4Result> results;
+   double scalingFreqFact,A,alpha,M,T1d,G,LHGap;
+   bool usrScaleFact,usrConstantA,usrAlpha;
+   bool usrConstantM,usrT1Diag,usrConstantG,usrLHGap;
+   G4ResultCache cache;
+   std::atomic<size_t> cacheHits;
+   std::atomic<size_t> cacheFailures;
+/* ************************************************************************** */
+};
+/* ************************************************************************** */
+
+
+#endif  /* _BATCHG4_H_ */
+
@@ -49,6 +49,7 @@ using std::scientific;
 using std::setprecision;
 #include <fstream>
 using std::ifstream;
+using std::ofstream;
 #include <vector>
 using std::vector;
 #include <string>
@@ -59,6 +60,14 @@ using std::string;
 #include "mytimer.h"
 #include "rawg4sdata.h"
 #include "calculateg4.h"
+#include "g09logextractor.h"
+#include "batchg4.h"
+#include "thermoscan.h"
+#include "g4parameterfit.h"
+#include "g4parametersweep.h"
+#include "g4uncertainty.h"
+#include "g4reactionnetwork.h"
+#include "g4resultwriter.h"
 
 int main (int argc, char *argv[]) {
    /* ************************************************************************** */
@@ -84,12 +93,288 @@ int main (int argc, char *argv[]) {
    if ( verboseLevel!=0 ) {
       ScreenUtils::PrintHappyStart(argv,CURRENTVERSION,PROGRAMCONTRIBUTORS);
    }
+   G4ResultWriter::Format outFormat=G4ResultWriter::JSONL;
+   if ( options->format ) {
+      if ( !G4ResultWriter::GetFormat(string(argv[options->format]),outFormat) ) {
+         ScreenUtils::DisplayErrorMessage(string("Unknown format '")+\
+               string(argv[options->format])+string("' (use jsonl or csv)."));
+         return EXIT_FAILURE;
+      }
+   }
+   double scanTMin=0.0e0,scanTMax=0.0e0;
+   long scanNum=0;
+   if ( options->thermoscan ) {
+      char* endp[3];
+      const char* ts[3]={argv[options->thermoscan],argv[options->thermoscan+1],\
+         argv[options->thermoscan+2]};
+      scanTMin=strtod(ts[0],&endp[0]);
+      scanTMax=strtod(ts[1],&endp[1]);
+      scanNum=strtol(ts[2],&endp[2],10);
+      bool ok=true;
+      for ( int k=0 ; k<3 ; ++k ) { if ( endp[k]==ts[k] || *endp[k]!='\0' ) { ok=false; } }
+      if ( !ok || !(scanTMin>0.0e0) || !(scanTMax>0.0e0) || scanNum<1 ) {
+         ScreenUtils::DisplayErrorMessage("The option --thermo-scan should be followed by"
+               " tmin tmax n (tmin, tmax > 0 K, and n >= 1).");
+         cout << "\nTry:\n\t" << argv[0] << " -h " << '\n';
+         cout << "\nto view the help menu.\n\n";
+         return EXIT_FAILURE;
+      }
+   }
    /* Main corpus  */
+   if ( options->refit ) {
+      G4ParameterFit fit;
+      if ( !fit.ReadTrainingSet(string(argv[1])) ) { return EXIT_FAILURE; }
+      if ( options->setalpha ) {
+         fit.SetInitialValue(G4ParameterFit::ALPHA,std::stod(string(argv[options->setalpha])));
+      }
+      if ( options->setconsta ) {
+         fit.SetInitialValue(G4ParameterFit::CONSTA,std::stod(string(argv[options->setconsta])));
+      }
+      if ( options->setscalefreqfact ) {
+         fit.SetInitialValue(G4ParameterFit::FREQFACT,std::stod(string(argv[options->setscalefreqfact])));
+      }
+      if ( options->refitfix ) {
+         string lst=string(",")+string(argv[options->refitfix])+string(",");
+         if ( lst.find(",alpha,")!=string::npos ) { fit.FitParameter(G4ParameterFit::ALPHA,false); }
+         if ( lst.find(",A,")!=string::npos ) { fit.FitParameter(G4ParameterFit::CONSTA,false); }
+         if ( lst.find(",freq-fact,")!=string::npos ) { fit.FitParameter(G4ParameterFit::FREQFACT,false); }
+      }
+      if ( !fit.Fit() ) {
+         ScreenUtils::DisplayErrorMessage("The refit failed; no parameters are reported.");
+         return EXIT_FAILURE;
+      }
+      if ( options->outFileName ) {
+         ofstream ofil(argv[options->outFileName]);
+         if ( !ofil.good() ) {
+            ScreenUtils::DisplayErrorFileNotOpen(string(argv[options->outFileName]));
+            ofil.close();
+            return EXIT_FAILURE;
+         }
+         fit.PrintResults(ofil);
+         ofil.close();
+      } else {
+         fit.PrintResults(cout);
+      }
+      if ( verboseLevel!=0 ) {
+         ScreenUtils::PrintHappyEnding();
+         timer.End();
+         timer.PrintElapsedTimeSec(string("global timer"));
+      }
+      return EXIT_SUCCESS;
+   }
+   if ( options->sweep ) {
+      G4ParameterSweep sweep;
+      if ( options->setalpha ) {
+         sweep.SetValue(G4ParameterSweep::ALPHA,std::stod(string(argv[options->setalpha])));
+      }
+      if ( options->setscalefreqfact ) {
+         sweep.SetValue(G4ParameterSweep::FREQFACT,std::stod(string(argv[options->setscalefreqfact])));
+      }
+      if ( options->setconsta ) {
+         sweep.SetValue(G4ParameterSweep::CONSTA,std::stod(string(argv[options->setconsta])));
+      }
+      if ( options->setconstm ) {
+         sweep.SetValue(G4ParameterSweep::CONSTM,std::stod(string(argv[options->setconstm])));
+      }
+      if ( options->setconstg ) {
+         sweep.SetValue(G4ParameterSweep::CONSTG,std::stod(string(argv[options->setconstg])));
+      }
+      if ( options->sett1diag ) {
+         sweep.SetT1Diag(std::stod(string(argv[options->sett1diag])));
+      }
+      if ( options->setlhgap ) {
+         sweep.SetLHGap(std::stod(string(argv[options->setlhgap])));
+      }
+      if ( !sweep.ReadSpecification(string(argv[options->sweep])) ) { return EXIT_FAILURE; }
+      if ( !sweep.ReadReports(BatchG4::GetListOfReports(string(argv[1]))) ) { return EXIT_FAILURE; }
+      if ( verboseLevel>0 ) {
+         cout << "Number of reports: " << sweep.NumberOfMolecules() << '\n';
+         cout << "Number of grid points: " << sweep.NumberOfPoints() << '\n';
+      }
+      if ( options->outFileName ) {
+         ofstream ofil(argv[options->outFileName]);
+         if ( !ofil.good() ) {
+            ScreenUtils::DisplayErrorFileNotOpen(string(argv[options->outFileName]));
+            ofil.close();
+            return EXIT_FAILURE;
+         }
+         sweep.PrintTable(ofil);
+         ofil.close();
+      } else {
+         sweep.PrintTable(cout);
+      }
+      if ( verboseLevel!=0 ) {
+         ScreenUtils::PrintHappyEnding();
+         timer.End();
+         timer.PrintElapsedTimeSec(string("global timer"));
+      }
+      return EXIT_SUCCESS;
+   }
+   if ( options->reactions ) {
+      G4ReactionNetwork net;
+      if ( options->setscalefreqfact ) {
+         net.SetScalingFreqencyFactor(std::stod(string(argv[options->setscalefreqfact])));
+      }
+      if ( options->setconsta ) {
+         net.SetConstantA(std::stod(string(argv[options->setconsta])));
+      }
+      if ( options->setalpha ) {
+         net.SetAlpha(std::stod(string(argv[options->setalpha])));
+      }
+      if ( !net.ReadNetwork(string(argv[1])) ) { return EXIT_FAILURE; }
+      size_t nthreads=0;
+      if ( options->threads ) {
+         nthreads=size_t(std::stoi(string(argv[options->threads])));
+      }
+      net.ComputeSpecies(nthreads);
+      net.DisplayMessages();
+      net.Solve();
+      if ( options->outFileName ) {
+         ofstream ofil(argv[options->outFileName]);
+         if ( !ofil.good() ) {
+            ScreenUtils::DisplayErrorFileNotOpen(string(argv[options->outFileName]));
+            ofil.close();
+            return EXIT_FAILURE;
+         }
+         net.PrintResults(ofil);
+         ofil.close();
+      } else {
+         net.PrintResults(cout);
+      }
+      if ( verboseLevel!=0 ) {
+         ScreenUtils::PrintHappyEnding();
+         timer.End();
+         timer.PrintElapsedTimeSec(string("global timer"));
+      }
+      return EXIT_SUCCESS;
+   }
+   if ( options->uncertainty ) {
+      G4Uncertainty unc;
+      if ( options->setscalefreqfact ) {
+         unc.SetScalingFreqencyFactor(std::stod(string(argv[options->setscalefreqfact])));
+      }
+      if ( options->setconsta ) {
+         unc.SetConstantA(std::stod(string(argv[options->setconsta])));
+      }
+      if ( options->setalpha ) {
+         unc.SetAlpha(std::stod(string(argv[options->setalpha])));
+      }
+      if ( !unc.ReadSpecification(string(argv[options->uncertainty])) ) { return EXIT_FAILURE; }
+      vector<string> repnames=BatchG4::GetListOfReports(string(argv[1]));
+      if ( repnames.size()==0 ) {
+         ScreenUtils::DisplayErrorMessage(string("No reports were found in '")+string(argv[1])+string("'."));
+         return EXIT_FAILURE;
+      }
+      if ( verboseLevel>0 ) {
+         cout << "Number of reports: " << repnames.size() << '\n';
+      }
+      size_t nthreads=0;
+      if ( options->threads ) {
+         nthreads=size_t(std::stoi(string(argv[options->threads])));
+      }
+      unc.Run(repnames,nthreads);
+      unc.DisplayMessages();
+      if ( options->outFileName ) {
+         ofstream ofil(argv[options->outFileName]);
+         if ( !ofil.good() ) {
+            ScreenUtils::DisplayErrorFileNotOpen(string(argv[options->outFileName]));
+            ofil.close();
+            return EXIT_FAILURE;
+         }
+         unc.PrintTable(ofil);
+         ofil.close();
+      } else {
+         unc.PrintTable(cout);
+      }
+      if ( unc.NumberOfFailures()>0 ) {
+         ScreenUtils::DisplayWarningMessage(std::to_string(unc.NumberOfFailures())+\
+               string(" report(s) could not be processed (written as nan)."));
+      }
+      if ( verboseLevel!=0 ) {
+         ScreenUtils::PrintHappyEnding();
+         timer.End();
+         timer.PrintElapsedTimeSec(string("global timer"));
+      }
+      return EXIT_SUCCESS;
+   }
+   if ( options->batch ) {
+      BatchG4 batch;
+      if ( !batch.SetupListOfReports(string(argv[1])) ) { return EXIT_FAILURE; }
+      if ( options->setscalefreqfact ) {
+         batch.SetScalingFreqencyFactor(std::stod(string(argv[options->setscalefreqfact])));
+      }
+      if ( options->setconsta ) {
+         batch.SetConstantA(std::stod(string(argv[options->setconsta])));
+      }
+      if ( options->setalpha ) {
+         batch.SetAlpha(std::stod(string(argv[options->setalpha])));
+      }
+      if ( options->setconstm ) {
+         batch.SetConstantM(std::stod(string(argv[options->setconstm])));
+      }
+      if ( options->sett1diag ) {
+         batch.SetT1Diag(std::stod(string(argv[options->sett1diag])));
+      }
+      if ( options->setconstg ) {
+         batch.SetConstantG(std::stod(string(argv[options->setconstg])));
+      }
+      if ( options->setlhgap ) {
+         batch.SetLHGap(std::stod(string(argv[options->setlhgap])));
+      }
+      if ( verboseLevel>0 ) {
+         cout << "Number of reports: " << batch.NumberOfReports() << '\n';
+      }
+      if ( options->cachefile ) {
+         if ( !batch.UseCache(string(argv[options->cachefile])) ) { return EXIT_FAILURE; }
+      }
+      size_t nthreads=0;
+      if ( options->threads ) {
+         nthreads=size_t(std::stoi(string(argv[options->threads])));
+      }
+      batch.Run(nthreads);
+      if ( options->cachefile && verboseLevel>0 ) {
+         cout << "Reports taken from the cache: " << batch.NumberOfCacheHits() << '\n';
+      }
+      batch.DisplayMessages();
+      if ( options->format ) {
+         string fname=(options->outFileName ? string(argv[options->outFileName]) : string(""));
+         if ( !batch.WriteResults(fname,outFormat) ) { return EXIT_FAILURE; }
+      } else if ( options->outFileName ) {
+         ofstream ofil(argv[options->outFileName]);
+         if ( !ofil.good() ) {
+            ScreenUtils::DisplayErrorFileNotOpen(string(argv[options->outFileName]));
+            ofil.close();
+            return EXIT_FAILURE;
+         }
+         batch.PrintTable(ofil);
+         ofil.close();
+      } else {
+         batch.PrintTable(cout);
+      }
+      if ( batch.NumberOfFailures()>0 ) {
+         ScreenUtils::DisplayWarningMessage(std::to_string(batch.NumberOfFailures())+\
+               string(" report(s) could not be processed (written as nan)."));
+      }
+      if ( verboseLevel!=0 ) {
+         ScreenUtils::PrintHappyEnding();
+         timer.End();
+         timer.PrintElapsedTimeSec(string("global timer"));
+      }
+      return EXIT_SUCCESS;
+   }
    string repname=argv[1];
    if ( verboseLevel>0 ) {
       cout << "Working file: " << repname << '\n';
    }
-   RawG4sData data(repname);
+   RawG4sData data;
+   if ( options->g09log ) {
+      G09LogExtractor extractor(repname,string(argv[options->g09log]),data);
+      if ( options->savereport && extractor.ImSetup() ) {
+         extractor.WriteReport(G09LogExtractor::GetReportName(repname),data);
+      }
+   } else {
+      data=RawG4sData(repname);
+   }
    if ( !(data.ImSetup()) ) { return EXIT_FAILURE; }
    cout << setprecision(10);
    if ( verboseLevel>0 ) { ScreenUtils::PrintScrStarLine(); }
@@ -118,47 +403,58 @@ int main (int argc, char *argv[]) {
    if ( options->setscalefreqfact || options->setconsta || options->setalpha ||\
         options->setconstm || options->sett1diag || options->setconstg ||\
         options->setlhgap ) {
-      cg.Compute();
+      if ( verboseLevel>0 ) { cg.DisplayParameters(); }
+   }
+   G4Variants var=cg.ComputeAllVariants();
+   cg.DisplayMessages();
+   if ( options->format ) {
+      G4ResultRow row;
+      G4ResultWriter::SetRow(var,row);
+      row.ok=cg.ComputeOK();
+      G4ResultWriter wrt;
+      if ( !wrt.Open(string(""),outFormat) ) { return EXIT_FAILURE; }
+      wrt.Write(repname,row);
+      if ( !wrt.Close() ) { return EXIT_FAILURE; }
+   } else {
+      if ( verboseLevel>0 ) { ScreenUtils::PrintScrStarLine(); }
+      cout << "lclZPE= " << var.lclZPE << '\n';
+      cout << "scaledZPE= " << var.scaledZPE << '\n';
+      cout << "G4-Nitro-Closed-XXX(0 K)= " << var.g4Energy << '\n';
+      cout << "G4-Nitro-Closed-XXX Enthalpy= " << var.g4Enthalpy0K[G4Variants::HORR] << '\n';
+      if ( verboseLevel>0 ) { ScreenUtils::PrintScrStarLine(); }
+      cout << setprecision(5);
+      const char* evibLabel[G4Variants::NEVIB]={"HO-RR","Nicolaides"};
+      const char* refLabel[G4Variants::NREF]={"NIST","Tajti","ATcT"};
+      string lbl;
+      for ( int iv=0 ; iv<G4Variants::NEVIB ; ++iv ) {
+         for ( int ir=0 ; ir<G4Variants::NREF ; ++ir ) {
+            lbl=string("Delta_H_f(298.15_K) [")+string(evibLabel[iv])+string("]/")+string(refLabel[ir])+string(":");
+            lbl.resize(40,' ');
+            cout << lbl << var.deltaHf298K[iv][ir] << " kJ mol-1\n";
+         }
+      }
+   }
+   if ( options->thermoscan ) {
+      vector<double> tgrid;
+      ThermoScan::LinearGrid(scanTMin,scanTMax,size_t(scanNum),tgrid);
+      ThermoScan scan;
+      if ( !scan.Compute(data,var.g4Energy,cg.GetScalingFrequencyFactor(),tgrid) ) {
+         scan.DisplayMessages();
+         return EXIT_FAILURE;
+      }
+      if ( options->outFileName ) {
+         ofstream ofil(argv[options->outFileName]);
+         if ( !ofil.good() ) {
+            ScreenUtils::DisplayErrorFileNotOpen(string(argv[options->outFileName]));
+            ofil.close();
+            return EXIT_FAILURE;
+         }
+         scan.PrintTable(ofil);
+         ofil.close();
+      } else {
+         scan.PrintTable(cout);
+      }
    }
-   
-   if ( verboseLevel>0 ) { ScreenUtils::PrintScrStarLine(); }
-   cout << "lclZPE= " << cg.LclZPE() << '\n';
-   cout << "scaledZPE= " << cg.ScaledZPE() << '\n';
-   cout << "G4-Nitro-Closed-XXX(0 K)= " << cg.G4Energy() << '\n';
-   cout << "G4-Nitro-Closed-XXX Enthalpy= " << cg.G4Enthalpy0K() << '\n';
-   if ( verboseLevel>0 ) { ScreenUtils::PrintScrStarLine(); }
-   cout << setprecision(5);
-   cout << "Delta_H_f(298.15_K) [HO-RR]/NIST:       " << cg.DeltaHf298KAtomization() << " kJ mol-1\n";
-
-   cg.UseNicolaidesCorrection(false);
-   cg.UseTajtiCorrection(true);
-   cg.UseArgonneData(false);
-   cg.Compute();
-   cout << "Delta_H_f(298.15_K) [HO-RR]/Tajti:      " << cg.DeltaHf298KAtomization() << " kJ mol-1\n";
-
-   cg.UseNicolaidesCorrection(false);
-   cg.UseTajtiCorrection(false);
-   cg.UseArgonneData(true);
-   cg.Compute();
-   cout << "Delta_H_f(298.15_K) [HO-RR]/ATcT:       " << cg.DeltaHf298KAtomization() << " kJ mol-1\n";
-
-   cg.UseNicolaidesCorrection(true);
-   cg.UseTajtiCorrection(false);
-   cg.UseArgonneData(false);
-   cg.Compute();
-   cout << "Delta_H_f(298.15_K) [Nicolaides]/NIST:  " << cg.DeltaHf298KAtomization() << " kJ mol-1\n";
-
-   cg.UseNicolaidesCorrection(true);
-   cg.UseTajtiCorrection(true);
-   cg.UseArgonneData(false);
-   cg.Compute();
-   cout << "Delta_H_f(298.15_K) [Nicolaides]/Tajti: " << cg.DeltaHf298KAtomization() << " kJ mol-1\n";
-
-   cg.UseNicolaidesCorrection(true);
-   cg.UseTajtiCorrection(false);
-   cg.UseArgonneData(true);
-   cg.Compute();
-   cout << "Delta_H_f(298.15_K) [Nicolaides]/ATcT:  " << cg.DeltaHf298KAtomization() << " kJ mol-1\n";
 
    //data.DisplayResults();
    //string entName=repname;
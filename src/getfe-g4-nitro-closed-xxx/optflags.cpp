@@ -61,6 +61,18 @@ OptionFlags::OptionFlags() : OptionFlagsBase() {
    sett1diag=0;
    setconstg=0;
    setlhgap=0;
+   g09log=0;
+   savereport=0;
+   batch=0;
+   threads=0;
+   thermoscan=0;
+   cachefile=0;
+   refit=0;
+   refitfix=0;
+   sweep=0;
+   uncertainty=0;
+   reactions=0;
+   format=0;
 }
 OptionFlags::OptionFlags(int &argc,char** &argv) : OptionFlags() {
    /* Remember to initialize local short ints before calling Init()!  */
@@ -94,6 +106,10 @@ void OptionFlags::Init(int &argc, char** &argv) {
             case 'h' :
                PrintHelpMenu(argc,argv);
                break;
+            case 'o' :
+               outFileName=(++i);
+               if (i>=argc) {PrintErrorMessage(argv,'o');}
+               break;
             case 'v' :
                verboseLevel=(++i);
                if (i>=argc) {PrintErrorMessage(argv,'v');}
@@ -134,10 +150,17 @@ void OptionFlags::PrintHelpMenu(int argc, char** &argv) {
    cout << endl;
    ScreenUtils::PrintScrStarLine();
    ScreenUtils::SetScrBoldFont();
-   cout << "\nUsage:\n\n\t" << rawprogramname << " report.dat [option [value(s)]] ... [option [value(s)]]\n\n";
+   cout << "\nUsage:\n\n\t" << rawprogramname << " report.dat [option [value(s)]] ... [option [value(s)]]\n";
+   cout << "\t" << rawprogramname << " dir|'pattern'|manifest --batch [option [value(s)]] ...\n";
+   cout << "\t" << rawprogramname << " trainingset --refit [option [value(s)]] ...\n";
+   cout << "\t" << rawprogramname << " network --reactions [option [value(s)]] ...\n";
+   cout << "\t" << rawprogramname << " report.dat|dir|'pattern'|manifest --sweep spec [option [value(s)]] ...\n";
+   cout << "\t" << rawprogramname << " report.dat|dir|'pattern'|manifest --uncertainty spec [option [value(s)]] ...\n\n";
    ScreenUtils::SetScrNormalFont();
    cout << "Here options can be:\n\n";
-   cout << "  -o outfname\tSets the output file name to be outfname." << endl;
+   cout << "  -o outfname\tSets the output file name to be outfname (only used\n"
+        << "             \t  together with --batch, --refit, --sweep, --reactions,\n"
+        << "             \t  --uncertainty, or --thermo-scan; default: std::cout)." << endl;
    cout << "  -v VerbLev \tSets the verbose level to be VerbLev. Default: 0.\n"
         << "             \t  The quantity of information printed to std::cout\n"
         << "             \t  increases as VerbLev increases, and VerbLev is an\n"
@@ -160,6 +183,71 @@ void OptionFlags::PrintHelpMenu(int argc, char** &argv) {
         << "                   \t  option --set-LHGap (below)." << '\n';
    cout << "  --set-LHGap lhg  \tSet LHGap to be lhg. This variable must be used\n"
         << "                   \t  together with option --set-const-G (above)." << '\n';
+   cout << "  --g09-log mthd   \tThe input file is not a report, but the g09 log/out file\n"
+        << "                   \t  of a G4-XXX calculation (all eight steps). The data is\n"
+        << "                   \t  extracted directly from the log file (no report is\n"
+        << "                   \t  needed). mthd is the method: std, b3lyp, wb97xd,\n"
+        << "                   \t  m062x, mp2, pbe1pbe, or pbepbe (see the option -m\n"
+        << "                   \t  of g4-nitro-closed-xxx)." << '\n';
+   cout << "  --save-report    \tTogether with --g09-log, saves the extracted data into\n"
+        << "                   \t  the file baseName-ReportG09.dat." << '\n';
+   cout << "  --batch          \tBatch mode. The input is not a single report, but a\n"
+        << "                   \t  directory (all its *-ReportG09.dat files are used),\n"
+        << "                   \t  a glob pattern (quote it, e.g. 'dir/c*-ReportG09.dat'),\n"
+        << "                   \t  or a manifest file (one report name per line; lines\n"
+        << "                   \t  starting with # are ignored). One row per molecule\n"
+        << "                   \t  is written (see -o). The --set-* options are applied\n"
+        << "                   \t  to all molecules." << '\n';
+   cout << "  --threads n      \tUse n threads in batch mode. Default: all the\n"
+        << "                   \t  available hardware threads. The output order\n"
+        << "                   \t  does not depend on n." << '\n';
+   cout << "  --refit          \tRefits alpha, A, and the frequency factor (Levenberg-\n"
+        << "                   \t  Marquardt). The input is a training set: a file with\n"
+        << "                   \t  one report name and its experimental Delta H_f(298.15 K)\n"
+        << "                   \t  (kJ mol-1) per line. The --set-alpha, --set-const-A, and\n"
+        << "                   \t  --set-freq-fact values are used as initial values.\n"
+        << "                   \t  The results are written to std::cout (or see -o)." << '\n';
+   cout << "  --refit-fix list \tTogether with --refit, keeps fixed the parameters of\n"
+        << "                   \t  list (comma separated; e.g. alpha,A or freq-fact)." << '\n';
+   cout << "  --sweep spec     \tEvaluates Delta H_f(298.15 K) [HO-RR]/NIST over a grid\n"
+        << "                   \t  of alpha, frequency factor, A, M, and G, for one or\n"
+        << "                   \t  many reports (same method). spec contains the keywords\n"
+        << "                   \t  SWEEP_ALPHA, SWEEP_FREQ_FACT, SWEEP_A, SWEEP_M, and/or\n"
+        << "                   \t  SWEEP_G, each followed by a line 'min max n'. The other\n"
+        << "                   \t  parameters are fixed (see --set-*). One row per grid\n"
+        << "                   \t  point is written (see -o)." << '\n';
+   cout << "  --reactions      \tComputes Delta H_f(298.15 K) from a network of reactions\n"
+        << "                   \t  (e.g. isodesmic) and reference species. The input is\n"
+        << "                   \t  a file with lines 'SPECIES name report [dHf_exp]',\n"
+        << "                   \t  'REACTION [c] A + [c] B = [c] C + ...', and, optionally,\n"
+        << "                   \t  'AUTO' (one element-balanced reaction per species, with\n"
+        << "                   \t  the smallest hydride references). The whole network is\n"
+        << "                   \t  solved at once (least squares). See -o and --threads." << '\n';
+   cout << "  --uncertainty spec\tMonte Carlo uncertainty of Delta H_f(298.15 K) [HO-RR]/NIST,\n"
+        << "                   \t  for one or many reports. spec contains the standard\n"
+        << "                   \t  deviations of the atomic Delta H_f(0 K) (SIGMA_DHF0_X,\n"
+        << "                   \t  kJ mol-1), the raw energies (SIGMA_B1,...,SIGMA_B11,\n"
+        << "                   \t  SIGMA_B13, hartree), and the frequencies (SIGMA_FREQ,\n"
+        << "                   \t  relative), and, optionally, UNC_SAMPLES and UNC_SEED.\n"
+        << "                   \t  The mean, sigma, and percentiles are written (see -o).\n"
+        << "                   \t  The results do not depend on --threads." << '\n';
+   cout << "  --format fmt     \tWrites the results as JSON Lines (fmt=jsonl) or CSV\n"
+        << "                   \t  (fmt=csv), one row per report, with a fixed set of\n"
+        << "                   \t  columns: id, ok, method, freq_fact, A, alpha, lcl_zpe,\n"
+        << "                   \t  scaled_zpe, g4_0K, g4_enthalpy (hartree), and the six\n"
+        << "                   \t  Delta H_f(298.15 K) variants (kJ mol-1). In batch mode\n"
+        << "                   \t  the rows are written to -o (or std::cout); for a single\n"
+        << "                   \t  report, the row replaces the usual std::cout output." << '\n';
+   cout << "  --cache fname    \tIn batch mode, use (or create) the result cache fname.\n"
+        << "                   \t  The results of a report are taken from the cache\n"
+        << "                   \t  if neither the report nor the --set-* options\n"
+        << "                   \t  changed since they were computed." << '\n';
+   cout << "  --thermo-scan tmin tmax n\n"
+        << "                   \tComputes H, S, Cp, and G (HO-RR, ideal gas, 1 atm) at n\n"
+        << "                   \t  evenly spaced temperatures, from tmin to tmax (in K).\n"
+        << "                   \t  The table is written after the usual results (see -o).\n"
+        << "                   \t  The report must contain the molecular mass and the\n"
+        << "                   \t  rotational data (see --save-report)." << '\n';
    cout << "  --help    \t\tSame as -h" << endl;
    cout << "  --version \t\tSame as -V" << endl;
    cout << endl;
@@ -212,6 +300,39 @@ void OptionFlags::ProcessDoubleDashOption(int &argc,char** &argv,int &pos) {
      setconstg=(++pos);
    } else if ( str==string("set-LHGap") ) {
      setlhgap=(++pos);
+   } else if ( str==string("g09-log") ) {
+     g09log=(++pos);
+   } else if ( str==string("save-report") ) {
+     savereport=pos;
+   } else if ( str==string("batch") ) {
+     batch=pos;
+   } else if ( str==string("threads") ) {
+     threads=(++pos);
+   } else if ( str==string("refit") ) {
+     refit=pos;
+   } else if ( str==string("refit-fix") ) {
+     refitfix=(++pos);
+   } else if ( str==string("sweep") ) {
+     sweep=(++pos);
+   } else if ( str==string("uncertainty") ) {
+     uncertainty=(++pos);
+   } else if ( str==string("reactions") ) {
+     reactions=pos;
+   } else if ( str==string("format") ) {
+     format=(++pos);
+   } else if ( str==string("cache") ) {
+     cachefile=(++pos);
+   } else if ( str==string("thermo-scan") ) {
+     thermoscan=(++pos);
+     pos+=2;
+     if ( pos>=argc ) {
+        ScreenUtils::SetScrRedBoldFont();
+        cout << "\nError: the option \"--thermo-scan\" should be followed by tmin tmax n." << endl;
+        ScreenUtils::SetScrNormalFont();
+        cout << "\nTry:\n\t" << argv[0] << " -h " << endl;
+        cout << "\nto view the help menu.\n\n";
+        exitcode=OptionFlagsBase::ExitCode::OFEC_EXITERR;
+     }
    } else {
       ScreenUtils::SetScrRedBoldFont();
       cout << "Error: Unrecognized option '" << argv[pos] << "'" << endl;
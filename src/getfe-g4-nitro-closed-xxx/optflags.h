@@ -117,6 +117,14 @@ public:
    unsigned short int setscalefreqfact,setconsta,setalpha;
    unsigned short int setconstm,sett1diag;
    unsigned short int setconstg,setlhgap;
+   unsigned short int g09log,savereport;
+   unsigned short int batch,threads;
+   unsigned short int thermoscan;
+   unsigned short int cachefile;
+   unsigned short int refit,refitfix;
+   unsigned short int sweep,uncertainty;
+   unsigned short int reactions;
+   unsigned short int format;
 protected:
 /* ************************************************************************** */
 };
@@ -48,6 +48,7 @@ using std::vector;
 #include "screenutils.h"
 #include "helpersmoleculeinfo.h"
 #include "moleculeinertiatensor.h"
+#include "bondgraph.h"
 HelpersMoleculeInfo::HelpersMoleculeInfo() {
    verboseLevel=0;
 }
@@ -76,6 +77,37 @@ size_t HelpersMoleculeInfo::NumberOfNeighbours(shared_ptr<Molecule> mol,size_t i
    }
    return (n.size()-1);
 }
+void HelpersMoleculeInfo::DisplayNumberOfNeighboursOfAllAtoms(shared_ptr<Molecule> mol) {
+   vector<size_t> start,nbr;
+   mol->ListOfNeighboursOfAllAtoms(start,nbr);
+   for ( size_t i=0 ; i<mol->Size() ; ++i ) {
+      cout << (i+1) << ' ' << (start[i+1]-start[i]) << '\n';
+   }
+}
+void HelpersMoleculeInfo::DisplayFragments(shared_ptr<Molecule> mol) {
+   mol->SetupBonds();
+   BondGraph g;
+   if ( !g.Setup(*mol) ) { return; }
+   size_t nf=g.ComputeFragments();
+   if ( verboseLevel>0 ) { cout << "Number of fragments: " << nf << '\n'; }
+   for ( size_t f=0 ; f<nf ; ++f ) {
+      for ( size_t k=0 ; k<g.FragmentSize(f) ; ++k ) {
+         cout << (g.FragmentAtom(f,k)+1) << (k<(g.FragmentSize(f)-1)? ' ' : '\n');
+      }
+   }
+}
+void HelpersMoleculeInfo::DisplayRings(shared_ptr<Molecule> mol) {
+   mol->SetupBonds();
+   BondGraph g;
+   if ( !g.Setup(*mol) ) { return; }
+   size_t nr=g.ComputeSSSR();
+   if ( verboseLevel>0 ) { cout << "Number of rings: " << nr << '\n'; }
+   for ( size_t r=0 ; r<nr ; ++r ) {
+      for ( size_t k=0 ; k<g.RingSize(r) ; ++k ) {
+         cout << (g.RingAtom(r,k)+1) << (k<(g.RingSize(r)-1)? ' ' : '\n');
+      }
+   }
+}
 bool HelpersMoleculeInfo::CheckIfMoleculeIsLinear(shared_ptr<Molecule> mol) {
    shared_ptr<MoleculeInertiaTensor> I=shared_ptr<MoleculeInertiaTensor>(new MoleculeInertiaTensor(mol));
    bool res=false;
@@ -61,6 +61,15 @@ public:
     * as opposed to 0 - (N-1). This is for the convenience of the user. */
    void DisplayIndicesOfNeighbourAtoms(shared_ptr<Molecule> mol,size_t idx);
    size_t NumberOfNeighbours(shared_ptr<Molecule> mol,size_t idx);
+   /** Displays the number of neighbours of every atom, one atom per line
+    * (index, from 1 to N, and number of neighbours).  */
+   void DisplayNumberOfNeighboursOfAllAtoms(shared_ptr<Molecule> mol);
+   /** Displays the fragments (sets of bonded atoms) of the molecule, one
+    * fragment per line (indices from 1 to N).  */
+   void DisplayFragments(shared_ptr<Molecule> mol);
+   /** Displays the smallest set of smallest rings, one ring per line
+    * (indices from 1 to N, consecutive atoms are bonded).  */
+   void DisplayRings(shared_ptr<Molecule> mol);
    /** Checks if the molecule is linear. If it is, the function returns true.  */
    bool CheckIfMoleculeIsLinear(shared_ptr<Molecule> mol);
 /* ************************************************************************** */
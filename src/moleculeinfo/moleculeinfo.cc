@@ -108,6 +108,15 @@ int main (int argc, char *argv[]) {
       size_t idx=size_t(std::stoi(string(argv[options->nofneighbours])));
       cout << hlp.NumberOfNeighbours(mol,idx) << '\n';
    }
+   if ( options->allneighbours ) {
+      hlp.DisplayNumberOfNeighboursOfAllAtoms(mol);
+   }
+   if ( options->fragments ) {
+      hlp.DisplayFragments(mol);
+   }
+   if ( options->rings ) {
+      hlp.DisplayRings(mol);
+   }
    if ( options->checklinearity ) {
       cout << (hlp.CheckIfMoleculeIsLinear(mol) ? 'y' : 'n') << '\n';
    }
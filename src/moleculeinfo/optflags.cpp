@@ -59,6 +59,9 @@ OptionFlags::OptionFlags(int argc,char** &argv) : OptionFlags() {
    /* Remember to initialize local short ints before calling Init()!  */
    verbose=false;
    checklinearity=false;
+   allneighbours=false;
+   fragments=false;
+   rings=false;
    neighboursofatom=nofneighbours=0;
    Init(argc,argv);
 }
@@ -90,6 +93,12 @@ void OptionFlags::Init(int argc, char** &argv) {
    for (int i=2; i<argc; i++){
       if (argv[i][0] == '-'){
          switch (argv[i][1]){
+            case 'c' :
+               allneighbours=true;
+               break;
+            case 'f' :
+               fragments=true;
+               break;
             case 'l' :
                checklinearity=true;
                break;
@@ -101,6 +110,9 @@ void OptionFlags::Init(int argc, char** &argv) {
                neighboursofatom=(++i);
                if (i>=argc) {PrintErrorMessage(argv,'N');}
                break;
+            case 'r' :
+               rings=true;
+               break;
             case 'o':
                outfname=(++i);
                if (i>=argc) {PrintErrorMessage(argv,'o');}
@@ -156,6 +168,10 @@ void OptionFlags::PrintHelpMenu(int argc, char** &argv) {
    cout << "The molecule information can be read from the following file-formats:\n"
         << "             \txyz, cub, pdb, and wfx." << '\n';
    cout << "Here options can be (assuming that the molecule has N atoms):\n\n";
+   cout << "  -c         \tDisplay the number of neighbours of every atom (one line\n"
+        << "             \t  per atom: index, from 1 to N, and number of neighbours)." << '\n';
+   cout << "  -f         \tDisplay the fragments (sets of bonded atoms) of the molecule,\n"
+        << "             \t  one fragment per line (indices from 1 to N)." << '\n';
    cout << "  -l         \tCheck if the molecule is linear." << '\n';
    cout << "  -n k       \tDisplay the number of neighbours of atom k.\n"
         << "             \t  k is the index of the atom as given in the input\n"
@@ -164,6 +180,8 @@ void OptionFlags::PrintHelpMenu(int argc, char** &argv) {
         << "             \t  are the indices of the atoms as given in the input file\n"
         << "             \t  (from 1 to N)." << '\n';
    cout << "  -o outfname\tSet the output file name to be outfname." << endl;
+   cout << "  -r         \tDisplay the smallest set of smallest rings, one ring per\n"
+        << "             \t  line (indices from 1 to N)." << '\n';
    cout << "  -v         \tPrint information other than the pure result." << endl;
    cout << "  -V         \tDisplay the version of this program." << endl;
    cout << "  -h         \tDisplay the help menu.\n\n";
@@ -117,6 +117,9 @@ public:
    /* insert here your personal flags.  */
    bool verbose;
    bool checklinearity;
+   bool allneighbours;
+   bool fragments;
+   bool rings;
    unsigned short int nofneighbours,neighboursofatom;
 /* ************************************************************************** */
 protected: